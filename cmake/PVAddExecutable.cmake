@@ -18,6 +18,7 @@
 #  FindLua.cmake is a standard CMake module from version 3 on.  To accommodate older
 #  versions of CMake, the FindLua.cmake from CMake 3.5.2 has been copied into
 #  ${PV_SOURCE_DIR}/cmake.
+# BLAS_LIBRARIES, CBLAS_INCLUDE_DIR. Needed if PV_USE_CBLAS is on.
 #
 
 macro(pv_add_executable TARGET)
@@ -45,6 +46,10 @@ macro(pv_add_executable TARGET)
     include_directories(${LUA_INCLUDE_DIR})
   endif()
 
+  if (PV_USE_CBLAS)
+    include_directories(${CBLAS_INCLUDE_DIR})
+  endif()
+
   if(CMAKE_BUILD_TYPE STREQUAL "Release" OR CMAKE_BUILD_TYPE STREQUAL "MinRelSize")
     list(APPEND CMAKE_CXX_FLAGS ${PV_COMPILE_FLAGS_RELEASE})
   else()
@@ -69,6 +74,7 @@ macro(pv_add_executable TARGET)
   endif()
 
   target_link_libraries(${TARGET} ${PV_LIBRARIES})
+  target_link_libraries(${TARGET} ${CMAKE_THREAD_LIBS_INIT})
 
   # Set target properties
   if(PARSED_ARGS_OUTPUT_PATH)
@@ -99,5 +105,9 @@ macro(pv_add_executable TARGET)
   if (PV_USE_LUA)
     target_link_libraries(${TARGET} ${LUA_LIBRARIES})
   endif (PV_USE_LUA)
+
+  if (PV_USE_CBLAS)
+    target_link_libraries(${TARGET} ${BLAS_LIBRARIES})
+  endif (PV_USE_CBLAS)
 endmacro()
 
@@ -56,6 +56,7 @@ macro(pv_config_project)
   set(PV_USE_CUDA_HELP "Defines if PetaVision uses CUDA GPU")
   set(PV_CUDA_RELEASE_HELP "Defines if Cuda compiles with optimization")
   set(PV_USE_LUA_HELP "Enable using a lua program as the params file")
+  set(PV_USE_CBLAS_HELP "Use an external CBLAS library for deliveryMode \"gemm\"")
   set(PV_CUDNN_PATH_HELP "Location of cuDNN libraries. Optional")
   set(PV_ADDRESS_SANITIZE_HELP "Add compiler flags for sanitizing addresses")
   set(PV_BUILD_SHARED_HELP "Build a shared library")
@@ -158,6 +159,7 @@ macro(pv_config_project)
   set(PV_USE_CUDA ON CACHE BOOL "${PV_USE_CUDA_HELP}")
   set(PV_CUDA_RELEASE ON CACHE BOOL ${PV_CUDA_RELEASE_HELP})
   set(PV_USE_LUA OFF CACHE BOOL "${PV_USE_LUA_HELP}")
+  set(PV_USE_CBLAS OFF CACHE BOOL "${PV_USE_CBLAS_HELP}")
   set(PV_ADDRESS_SANITIZE OFF CACHE BOOL "${PV_ADDRESS_SANITIZE_HELP}")
   set(PV_BUILD_SHARED OFF CACHE BOOL "${PV_BUILD_SHARED_HELP}")
   set(PV_DEBUG_OUTPUT OFF CACHE BOOL "${PV_DEBUG_OUTPUT_HELP}")
@@ -246,6 +248,9 @@ macro(pv_config_project)
     find_package(MPI)
   endif()
 
+  # The Checkpointer writes checkpoints in the background using std::thread.
+  find_package(Threads REQUIRED)
+
   if (PV_USE_LUA)
     find_package(Lua)
     if (LUA_FOUND)
@@ -256,4 +261,14 @@ macro(pv_config_project)
       message(FATAL_ERROR "Lua was not found")
     endif (LUA_FOUND)
   endif (PV_USE_LUA)
+
+  # The gemm delivery calls cblas_sgemm from inside OpenMP parallel regions; a multithreaded
+  # BLAS should be limited to one thread (e.g. OPENBLAS_NUM_THREADS=1).
+  if (PV_USE_CBLAS)
+    find_package(BLAS)
+    find_path(CBLAS_INCLUDE_DIR cblas.h PATH_SUFFIXES openblas)
+    if (NOT BLAS_FOUND OR NOT CBLAS_INCLUDE_DIR)
+      message(FATAL_ERROR "PV_USE_CBLAS is on, but a BLAS library with cblas.h was not found")
+    endif (NOT BLAS_FOUND OR NOT CBLAS_INCLUDE_DIR)
+  endif (PV_USE_CBLAS)
 endmacro()
@@ -0,0 +1,56 @@
+/*
+ * BackgroundCheckpointWriter.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "BackgroundCheckpointWriter.hpp"
+
+namespace PV {
+
+BackgroundCheckpointWriter::BackgroundCheckpointWriter() {
+   mThread = std::thread(&BackgroundCheckpointWriter::run, this);
+}
+
+BackgroundCheckpointWriter::~BackgroundCheckpointWriter() {
+   {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mShuttingDown = true;
+   }
+   mCondition.notify_all();
+   mThread.join();
+}
+
+void BackgroundCheckpointWriter::submit(std::shared_ptr<CheckpointStagingArena> arena) {
+   {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mQueue.push_back(arena);
+   }
+   mCondition.notify_all();
+}
+
+void BackgroundCheckpointWriter::finish() {
+   std::unique_lock<std::mutex> lock(mMutex);
+   mCondition.wait(lock, [this]() { return mQueue.empty() and !mWriting; });
+}
+
+void BackgroundCheckpointWriter::run() {
+   std::unique_lock<std::mutex> lock(mMutex);
+   while (true) {
+      mCondition.wait(lock, [this]() { return !mQueue.empty() or mShuttingDown; });
+      if (mQueue.empty()) {
+         break; // Shutting down, and everything submitted has been written.
+      }
+      std::shared_ptr<CheckpointStagingArena> arena = mQueue.front();
+      mQueue.pop_front();
+      mWriting = true;
+      lock.unlock();
+      arena->writeFiles();
+      arena = nullptr;
+      lock.lock();
+      mWriting = false;
+      mCondition.notify_all();
+   }
+}
+
+} // namespace PV
@@ -0,0 +1,58 @@
+/*
+ * BackgroundCheckpointWriter.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef BACKGROUNDCHECKPOINTWRITER_HPP_
+#define BACKGROUNDCHECKPOINTWRITER_HPP_
+
+#include "checkpointing/CheckpointStagingArena.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace PV {
+
+/**
+ * Owns a thread that writes staged checkpoints to disk. The Checkpointer stages a checkpoint
+ * into a CheckpointStagingArena, hands it to submit(), and continues the run; the thread writes
+ * the arenas in the order they were submitted. The thread does not call MPI.
+ */
+class BackgroundCheckpointWriter {
+  public:
+   BackgroundCheckpointWriter();
+
+   /**
+    * Waits for any submitted arenas to be written, and then stops the thread.
+    */
+   ~BackgroundCheckpointWriter();
+
+   /**
+    * Queues the arena to be written by the background thread, and returns immediately.
+    */
+   void submit(std::shared_ptr<CheckpointStagingArena> arena);
+
+   /**
+    * Blocks until every arena that has been submitted has been written.
+    */
+   void finish();
+
+  private:
+   void run();
+
+  private:
+   std::mutex mMutex;
+   std::condition_variable mCondition;
+   std::deque<std::shared_ptr<CheckpointStagingArena>> mQueue;
+   bool mWriting      = false;
+   bool mShuttingDown = false;
+   std::thread mThread;
+};
+
+} // namespace PV
+
+#endif // BACKGROUNDCHECKPOINTWRITER_HPP_
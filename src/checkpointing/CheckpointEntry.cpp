@@ -15,6 +15,26 @@
 
 namespace PV {
 
+void CheckpointEntry::stage(
+      std::string const &checkpointDirectory,
+      double simTime,
+      bool verifyWritesFlag,
+      CheckpointStagingArena *arena) const {
+   mStagingArena = arena;
+   write(checkpointDirectory, simTime, verifyWritesFlag);
+   mStagingArena = nullptr;
+}
+
+FileStream *
+CheckpointEntry::openOutputStream(std::string const &path, bool verifyWritesFlag) const {
+   if (mStagingArena) {
+      return mStagingArena->openFile(path, verifyWritesFlag);
+   }
+   else {
+      return new FileStream(path.c_str(), std::ios_base::out, verifyWritesFlag);
+   }
+}
+
 std::string CheckpointEntry::generatePath(
       std::string const &checkpointDirectory,
       std::string const &extension) const {
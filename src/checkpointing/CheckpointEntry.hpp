@@ -8,6 +8,8 @@
 #ifndef CHECKPOINTENTRY_HPP_
 #define CHECKPOINTENTRY_HPP_
 
+#include "checkpointing/CheckpointStagingArena.hpp"
+#include "io/FileStream.hpp"
 #include "structures/MPIBlock.hpp"
 #include <string>
 
@@ -34,9 +36,40 @@ class CheckpointEntry {
    }
    virtual void read(std::string const &checkpointDirectory, double *simTimePtr) const { return; }
    virtual void remove(std::string const &checkpointDirectory) const { return; }
+
+   /**
+    * Writes the same file or files as write(), but using MPI-IO, with each process in the
+    * MPIBlock writing its own part of the file, instead of gathering the data to the root
+    * process. All processes in the block must call this method together.
+    * The default calls write(); derived classes whose files can be assembled from per-process
+    * pieces override it.
+    */
+   virtual void writeCollective(
+         std::string const &checkpointDirectory,
+         double simTime,
+         bool verifyWritesFlag) const {
+      write(checkpointDirectory, simTime, verifyWritesFlag);
+   }
+
+   /**
+    * Calls write(), but with the files that write() opens using openOutputStream() created in
+    * the given arena instead of on disk. Any MPI communication that write() needs takes place
+    * during the call, so that the arena can be written to disk later by a thread that does not
+    * use MPI. Files that a derived class opens without openOutputStream() are written directly.
+    */
+   void stage(
+         std::string const &checkpointDirectory,
+         double simTime,
+         bool verifyWritesFlag,
+         CheckpointStagingArena *arena) const;
    std::string const &getName() const { return mName; }
 
   protected:
+   /**
+    * Returns a new FileStream for writing the given path, which the caller must delete.
+    * Inside a call to stage(), the stream is a StagedFileStream belonging to the staging arena.
+    */
+   FileStream *openOutputStream(std::string const &path, bool verifyWritesFlag) const;
    std::string
    generatePath(std::string const &checkpointDirectory, std::string const &extension) const;
    void deleteFile(std::string const &checkpointDirectory, std::string const &extension) const;
@@ -46,6 +79,7 @@ class CheckpointEntry {
   private:
    std::string mName;
    MPIBlock const *mMPIBlock;
+   mutable CheckpointStagingArena *mStagingArena = nullptr;
 };
 
 } // end namespace PV
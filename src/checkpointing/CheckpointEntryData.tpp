@@ -19,12 +19,14 @@ void CheckpointEntryData<T>::write(
       double simTime,
       bool verifyWritesFlag) const {
    if (getMPIBlock()->getRank() == 0) {
-      std::string path = generatePath(checkpointDirectory, "bin");
-      FileStream fileStream{path.c_str(), std::ios_base::out, verifyWritesFlag};
-      fileStream.write(mDataPointer, sizeof(T) * (std::size_t)mNumValues);
-      path = generatePath(checkpointDirectory, "txt");
-      FileStream txtStream(path.c_str(), std::ios_base::out, verifyWritesFlag);
-      TextOutput::print(mDataPointer, mNumValues, txtStream);
+      std::string path       = generatePath(checkpointDirectory, "bin");
+      FileStream *fileStream = openOutputStream(path, verifyWritesFlag);
+      fileStream->write(mDataPointer, sizeof(T) * (std::size_t)mNumValues);
+      delete fileStream;
+      path                  = generatePath(checkpointDirectory, "txt");
+      FileStream *txtStream = openOutputStream(path, verifyWritesFlag);
+      TextOutput::print(mDataPointer, mNumValues, *txtStream);
+      delete txtStream;
    }
 }
 
@@ -14,7 +14,8 @@
 namespace PV {
 
 // Constructors defined in .hpp file.
-// Write and remove methods inherited from CheckpointEntryPvp.
+// The remove method is inherited from CheckpointEntryPvp; write and writeCollective are overridden
+// to release the level copies that compact data stores make while writing.
 
 void CheckpointEntryDataStore::read(std::string const &checkpointDirectory, double *simTimePtr)
       const {
@@ -24,6 +25,36 @@ void CheckpointEntryDataStore::read(std::string const &checkpointDirectory, doub
          mDataStore->markActiveIndicesOutOfSync(bufferId, levelId);
       }
    }
+   if (mDataStore->hasCompactLevels()) {
+      // The older levels were read into dense copies, which are released below; their active
+      // indices are all that is kept, so they must be formed now.
+      for (int bufferId = 0; bufferId < mDataStore->getNumBuffers(); bufferId++) {
+         for (int levelId = 1; levelId < mDataStore->getNumLevels(); levelId++) {
+            mDataStore->updateActiveIndices(bufferId, levelId);
+         }
+      }
+      mDataStore->releaseLevelCopies();
+   }
+}
+
+void CheckpointEntryDataStore::write(
+      std::string const &checkpointDirectory,
+      double simTime,
+      bool verifyWritesFlag) const {
+   CheckpointEntryPvp::write(checkpointDirectory, simTime, verifyWritesFlag);
+   if (mDataStore->hasCompactLevels()) {
+      mDataStore->releaseLevelCopies();
+   }
+}
+
+void CheckpointEntryDataStore::writeCollective(
+      std::string const &checkpointDirectory,
+      double simTime,
+      bool verifyWritesFlag) const {
+   CheckpointEntryPvp::writeCollective(checkpointDirectory, simTime, verifyWritesFlag);
+   if (mDataStore->hasCompactLevels()) {
+      mDataStore->releaseLevelCopies();
+   }
 }
 
 int CheckpointEntryDataStore::getNumFrames() const {
@@ -33,6 +33,15 @@ class CheckpointEntryDataStore : public CheckpointEntryPvp<float> {
 
    virtual void read(std::string const &checkpointDirectory, double *simTimePtr) const override;
 
+   // If the data store keeps its older levels compactly, writing and reading them make dense
+   // copies of every level; these overrides release the copies afterward.
+   virtual void write(std::string const &checkpointDirectory, double simTime, bool verifyWritesFlag)
+         const override;
+   virtual void writeCollective(
+         std::string const &checkpointDirectory,
+         double simTime,
+         bool verifyWritesFlag) const override;
+
   protected:
    virtual int getNumFrames() const override;
    virtual float *calcBatchElementStart(int batchElement) const override;
@@ -31,6 +31,10 @@ class CheckpointEntryPvp : public CheckpointEntry {
          bool extended);
    virtual void write(std::string const &checkpointDirectory, double simTime, bool verifyWritesFlag)
          const override;
+   virtual void writeCollective(
+         std::string const &checkpointDirectory,
+         double simTime,
+         bool verifyWritesFlag) const override;
    virtual void read(std::string const &checkpointDirectory, double *simTimePtr) const override;
    virtual void remove(std::string const &checkpointDirectory) const override;
 
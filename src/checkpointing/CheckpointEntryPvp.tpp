@@ -64,7 +64,7 @@ void CheckpointEntryPvp<T>::write(
    FileStream *fileStream = nullptr;
    if (getMPIBlock()->getRank() == 0) {
       std::string path = generatePath(checkpointDirectory, "pvp");
-      fileStream       = new FileStream(path.c_str(), std::ios_base::out, verifyWritesFlag);
+      fileStream       = this->openOutputStream(path, verifyWritesFlag);
       BufferUtils::ActivityHeader header =
             BufferUtils::buildActivityHeader<T>(nxBlock, nyBlock, mLayerLoc->nf, numFrames);
       BufferUtils::writeActivityHeader(*fileStream, header);
@@ -96,6 +96,140 @@ void CheckpointEntryPvp<T>::write(
    delete fileStream;
 }
 
+template <typename T>
+void CheckpointEntryPvp<T>::writeCollective(
+      std::string const &checkpointDirectory,
+      double simTime,
+      bool verifyWritesFlag) const {
+#ifdef PV_USE_MPI
+   MPIBlock const *mpiBlock = getMPIBlock();
+   int const numFrames      = getNumFrames();
+   int const nx             = mLayerLoc->nx;
+   int const ny             = mLayerLoc->ny;
+   int const nf             = mLayerLoc->nf;
+   int const nxBlock        = nx * mpiBlock->getNumColumns();
+   int const nyBlock        = ny * mpiBlock->getNumRows();
+
+   // The layout is the same as the file that write() produces: the header, and then for each
+   // frame, the timestamp followed by the block's data in (y, x, f) order.
+   MPI_Offset const headerSize = (MPI_Offset)sizeof(BufferUtils::ActivityHeader);
+   MPI_Offset const frameDataSize =
+         (MPI_Offset)nxBlock * (MPI_Offset)nyBlock * (MPI_Offset)nf * (MPI_Offset)sizeof(T);
+   MPI_Offset const frameSize = (MPI_Offset)sizeof(double) + frameDataSize;
+
+   std::string path = generatePath(checkpointDirectory, "pvp");
+   auto checkStatus = [&path](int status, char const *operation) {
+      FatalIf(
+            status != MPI_SUCCESS,
+            "CheckpointEntryPvp::writeCollective: %s failed for \"%s\"\n",
+            operation,
+            path.c_str());
+   };
+   int const mode = MPI_MODE_CREATE | (verifyWritesFlag ? MPI_MODE_RDWR : MPI_MODE_WRONLY);
+   MPI_File fileHandle;
+   checkStatus(
+         MPI_File_open(mpiBlock->getComm(), path.c_str(), mode, MPI_INFO_NULL, &fileHandle),
+         "MPI_File_open");
+   checkStatus(MPI_File_set_size(fileHandle, (MPI_Offset)0), "MPI_File_set_size");
+
+   BufferUtils::ActivityHeader header =
+         BufferUtils::buildActivityHeader<T>(nxBlock, nyBlock, nf, numFrames);
+   if (mpiBlock->getRank() == 0) {
+      checkStatus(
+            MPI_File_write_at(
+                  fileHandle, 0, &header, (int)sizeof(header), MPI_BYTE, MPI_STATUS_IGNORE),
+            "writing the header");
+      for (int frame = 0; frame < numFrames; frame++) {
+         checkStatus(
+               MPI_File_write_at(
+                     fileHandle,
+                     headerSize + (MPI_Offset)frame * frameSize,
+                     &simTime,
+                     (int)sizeof(simTime),
+                     MPI_BYTE,
+                     MPI_STATUS_IGNORE),
+               "writing a timestamp");
+      }
+   }
+
+   // Each process's part of a frame is a rectangle of the frame, taken as rows of bytes.
+   int const localRowSize = nx * nf * (int)sizeof(T);
+   int sizes[2]           = {nyBlock, localRowSize * mpiBlock->getNumColumns()};
+   int subsizes[2]        = {ny, localRowSize};
+   int starts[2] = {ny * mpiBlock->getRowIndex(), localRowSize * mpiBlock->getColumnIndex()};
+   MPI_Datatype tileType;
+   MPI_Type_create_subarray(2, sizes, subsizes, starts, MPI_ORDER_C, MPI_BYTE, &tileType);
+   MPI_Type_commit(&tileType);
+
+   int const nxExtLocal = nx + mXMargins;
+   int const nyExtLocal = ny + mYMargins;
+   for (int frame = 0; frame < numFrames; frame++) {
+      // Processes that do not hold this frame take part in the collective calls with no data.
+      std::vector<T> tileData;
+      if (calcMPIBatchIndex(frame) == mpiBlock->getBatchIndex()) {
+         Buffer<T> pvpBuffer{calcBatchElementStart(frame), nxExtLocal, nyExtLocal, nf};
+         pvpBuffer.crop(nx, ny, Buffer<T>::CENTER);
+         tileData = pvpBuffer.asVector();
+      }
+      int const tileSize = (int)(tileData.size() * sizeof(T));
+
+      MPI_Offset const frameDataStart =
+            headerSize + (MPI_Offset)frame * frameSize + (MPI_Offset)sizeof(double);
+      checkStatus(
+            MPI_File_set_view(
+                  fileHandle, frameDataStart, MPI_BYTE, tileType, "native", MPI_INFO_NULL),
+            "MPI_File_set_view");
+      checkStatus(
+            MPI_File_write_at_all(
+                  fileHandle, 0, tileData.data(), tileSize, MPI_BYTE, MPI_STATUS_IGNORE),
+            "MPI_File_write_at_all");
+
+      if (verifyWritesFlag) {
+         // The sync-barrier-sync sequence makes every process's writes visible to the reads.
+         MPI_File_sync(fileHandle);
+         MPI_Barrier(mpiBlock->getComm());
+         MPI_File_sync(fileHandle);
+         std::vector<T> readBack(tileData.size());
+         checkStatus(
+               MPI_File_read_at_all(
+                     fileHandle, 0, readBack.data(), tileSize, MPI_BYTE, MPI_STATUS_IGNORE),
+               "MPI_File_read_at_all");
+         FatalIf(
+               std::memcmp(readBack.data(), tileData.data(), (std::size_t)tileSize) != 0,
+               "CheckpointEntryPvp::writeCollective: verifying frame %d of \"%s\" failed.\n",
+               frame,
+               path.c_str());
+      }
+   }
+   MPI_Type_free(&tileType);
+
+   if (verifyWritesFlag) {
+      checkStatus(
+            MPI_File_set_view(fileHandle, 0, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL),
+            "MPI_File_set_view");
+      if (mpiBlock->getRank() == 0) {
+         BufferUtils::ActivityHeader headerReadBack;
+         checkStatus(
+               MPI_File_read_at(
+                     fileHandle,
+                     0,
+                     &headerReadBack,
+                     (int)sizeof(headerReadBack),
+                     MPI_BYTE,
+                     MPI_STATUS_IGNORE),
+               "reading back the header");
+         FatalIf(
+               std::memcmp(&headerReadBack, &header, sizeof(header)) != 0,
+               "CheckpointEntryPvp::writeCollective: verifying the header of \"%s\" failed.\n",
+               path.c_str());
+      }
+   }
+   checkStatus(MPI_File_close(&fileHandle), "MPI_File_close");
+#else // PV_USE_MPI
+   write(checkpointDirectory, simTime, verifyWritesFlag);
+#endif // PV_USE_MPI
+}
+
 template <typename T>
 void CheckpointEntryPvp<T>::read(std::string const &checkpointDirectory, double *simTimePtr) const {
    int const numFrames = getNumFrames();
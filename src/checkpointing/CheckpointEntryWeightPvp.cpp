@@ -28,7 +28,7 @@ void CheckpointEntryWeightPvp::write(
    path.append("/").append(getName()).append(".pvp");
    FileStream *fileStream = nullptr;
    if (getMPIBlock()->getRank() == 0) {
-      fileStream = new FileStream(path.c_str(), std::ios_base::out, verifyWritesFlag);
+      fileStream = openOutputStream(path, verifyWritesFlag);
    }
 
    WeightsFileIO weightFileIO(fileStream, getMPIBlock(), mWeights);
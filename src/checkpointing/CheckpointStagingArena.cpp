@@ -0,0 +1,175 @@
+/*
+ * CheckpointStagingArena.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "CheckpointStagingArena.hpp"
+#include "io/StagedFileStream.hpp"
+#include "io/io.hpp"
+#include "utils/BufferUtilsPvp.hpp"
+#include "utils/PVLog.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace PV {
+
+FileStream *CheckpointStagingArena::openFile(std::string const &path, bool verifyWrites) {
+   StagedFileStream *stagedFileStream = new StagedFileStream(path.c_str());
+   StagedFile stagedFile;
+   stagedFile.mPath         = stagedFileStream->getFileName();
+   stagedFile.mVerifyWrites = verifyWrites;
+   stagedFile.mContents     = stagedFileStream->getContents();
+   mStagedFiles.push_back(stagedFile);
+   return stagedFileStream;
+}
+
+void CheckpointStagingArena::linkFile(std::string const &path, std::string const &existingPath) {
+   StagedFile stagedFile;
+   stagedFile.mPath         = expandLeadingTilde(path);
+   stagedFile.mVerifyWrites = false;
+   stagedFile.mContents     = nullptr;
+   stagedFile.mLinkTarget   = expandLeadingTilde(existingPath);
+   mStagedFiles.push_back(stagedFile);
+}
+
+void CheckpointStagingArena::linkUnchangedFiles(
+      std::string const &previousDirectory,
+      std::map<std::string, FileDigest> &fileDigests) {
+   for (auto &s : mStagedFiles) {
+      if (!s.mLinkTarget.empty()) {
+         continue;
+      }
+      std::string const fileName = s.mPath.substr(s.mPath.find_last_of('/') + 1);
+      FileDigest const digest    = calcDigest(*s.mContents);
+      auto found                 = fileDigests.find(fileName);
+      if (found != fileDigests.end() and found->second == digest and !previousDirectory.empty()) {
+         // The contents are kept, in case the link cannot be made.
+         s.mLinkTarget = expandLeadingTilde(previousDirectory + "/" + fileName);
+      }
+      fileDigests[fileName] = digest;
+   }
+}
+
+void CheckpointStagingArena::writeFiles() {
+   for (auto &s : mStagedFiles) {
+      int unlinkStatus = unlink(s.mPath.c_str());
+      FatalIf(
+            unlinkStatus != 0 and errno != ENOENT,
+            "Unable to remove existing file \"%s\": %s\n",
+            s.mPath.c_str(),
+            std::strerror(errno));
+      if (!s.mLinkTarget.empty()) {
+         if (link(s.mLinkTarget.c_str(), s.mPath.c_str()) == 0) {
+            s.mContents = nullptr;
+            continue;
+         }
+         WarnLog().printf(
+               "Unable to link \"%s\" to \"%s\" (%s); copying it instead.\n",
+               s.mPath.c_str(),
+               s.mLinkTarget.c_str(),
+               std::strerror(errno));
+         if (s.mContents == nullptr) {
+            s.mContents = readFile(s.mLinkTarget);
+         }
+      }
+      FileStream fileStream(
+            s.mPath.c_str(), std::ios_base::out | std::ios_base::binary, s.mVerifyWrites);
+      if (!s.mContents->empty()) {
+         fileStream.write(s.mContents->data(), (long)s.mContents->size());
+      }
+      s.mContents = nullptr;
+   }
+   mStagedFiles.clear();
+}
+
+std::size_t CheckpointStagingArena::getSize() const {
+   std::size_t size = (std::size_t)0;
+   for (auto &s : mStagedFiles) {
+      if (s.mLinkTarget.empty()) {
+         size += s.mContents->size();
+      }
+   }
+   return size;
+}
+
+CheckpointStagingArena::FileDigest
+CheckpointStagingArena::calcDigest(std::vector<char> const &contents) {
+   std::vector<std::size_t> skipOffsets = findPvpTimestamps(contents);
+   skipOffsets.push_back(contents.size());
+
+   std::uint64_t hash = (std::uint64_t)14695981039346656037ULL;
+   std::size_t k      = (std::size_t)0;
+   for (std::size_t skipOffset : skipOffsets) {
+      for (; k < skipOffset; k++) {
+         hash ^= (std::uint64_t)(unsigned char)contents[k];
+         hash *= (std::uint64_t)1099511628211ULL;
+      }
+      k += sizeof(double);
+   }
+   FileDigest digest;
+   digest.mSize = contents.size();
+   digest.mHash = hash;
+   return digest;
+}
+
+std::vector<std::size_t>
+CheckpointStagingArena::findPvpTimestamps(std::vector<char> const &contents) {
+   std::vector<std::size_t> offsets;
+   BufferUtils::ActivityHeader header;
+   if (contents.size() < sizeof(header)) {
+      return offsets;
+   }
+   std::memcpy(&header, contents.data(), sizeof(header));
+   if (header.numParams * (int)sizeof(int) != header.headerSize) {
+      return offsets;
+   }
+   std::size_t const headerSize      = (std::size_t)header.headerSize;
+   std::size_t const timestampOffset = offsetof(BufferUtils::ActivityHeader, timestamp);
+   switch (header.fileType) {
+      case PVP_WGT_FILE_TYPE:
+      case PVP_KERNEL_FILE_TYPE:
+         // A checkpoint holds a single frame, so the header's is the only timestamp.
+         if (headerSize == sizeof(BufferUtils::WeightHeader) and contents.size() >= headerSize) {
+            offsets.push_back(timestampOffset);
+         }
+         break;
+      case PVP_NONSPIKING_ACT_FILE_TYPE: {
+         if (headerSize != sizeof(header) or header.nx <= 0 or header.ny <= 0 or header.nf <= 0
+             or header.dataSize <= 0 or header.nBands < 0) {
+            break;
+         }
+         std::size_t const frameSize = sizeof(double)
+                                       + (std::size_t)header.nx * (std::size_t)header.ny
+                                               * (std::size_t)header.nf
+                                               * (std::size_t)header.dataSize;
+         if (contents.size() != headerSize + (std::size_t)header.nBands * frameSize) {
+            break;
+         }
+         offsets.push_back(timestampOffset);
+         for (int frame = 0; frame < header.nBands; frame++) {
+            offsets.push_back(headerSize + (std::size_t)frame * frameSize);
+         }
+      } break;
+      default: break;
+   }
+   return offsets;
+}
+
+std::shared_ptr<std::vector<char> const> CheckpointStagingArena::readFile(std::string const &path) {
+   struct stat pathStat;
+   int statStatus = stat(path.c_str(), &pathStat);
+   FatalIf(statStatus != 0, "Unable to stat \"%s\": %s\n", path.c_str(), std::strerror(errno));
+   auto contents = std::make_shared<std::vector<char>>((std::size_t)pathStat.st_size);
+   FileStream fileStream(path.c_str(), std::ios_base::in | std::ios_base::binary, false);
+   if (!contents->empty()) {
+      fileStream.read(contents->data(), (long)contents->size());
+   }
+   return contents;
+}
+
+} // namespace PV
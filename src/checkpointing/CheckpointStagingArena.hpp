@@ -0,0 +1,117 @@
+/*
+ * CheckpointStagingArena.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHECKPOINTSTAGINGARENA_HPP_
+#define CHECKPOINTSTAGINGARENA_HPP_
+
+#include "io/FileStream.hpp"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PV {
+
+/**
+ * Holds in memory the files of a checkpoint that is to be written in the background, or written
+ * incrementally. CheckpointEntry::stage() opens its files with openFile(), and the background
+ * writer or the Checkpointer calls writeFiles() to put them on disk. The files are written in the
+ * order in which they were opened. A file can instead be made a hard link to a file in an older
+ * checkpoint, either explicitly with linkFile() or, if its contents have not changed, with
+ * linkUnchangedFiles().
+ */
+class CheckpointStagingArena {
+  public:
+   /**
+    * Identifies the contents of a file, by its size and a 64-bit FNV-1a hash of its bytes. The
+    * timestamps of a pvp file, which change with every checkpoint even if the data do not, are
+    * left out of the hash (see findPvpTimestamps()).
+    */
+   struct FileDigest {
+      std::size_t mSize;
+      std::uint64_t mHash;
+      bool operator==(FileDigest const &other) const {
+         return mSize == other.mSize and mHash == other.mHash;
+      }
+   };
+
+   CheckpointStagingArena() {}
+   ~CheckpointStagingArena() {}
+
+   /**
+    * Returns a new StagedFileStream for the given path. The caller owns the stream, but its
+    * contents belong to the arena. If verifyWrites is true, writeFiles() reads back the file
+    * after writing it, as FileStream does.
+    */
+   FileStream *openFile(std::string const &path, bool verifyWrites);
+
+   /**
+    * Arranges for writeFiles() to create the given path as a hard link to existingPath. If the
+    * link cannot be made, writeFiles() copies existingPath instead.
+    */
+   void linkFile(std::string const &path, std::string const &existingPath);
+
+   /**
+    * For each staged file whose digest matches the entry for its file name in fileDigests,
+    * arranges for writeFiles() to make the file a hard link to the file of the same name in
+    * previousDirectory, instead of writing its contents. If previousDirectory is empty, no files
+    * are linked. Then sets the fileDigests entries to the digests of the staged files, so that
+    * the next checkpoint can be compared with this one. Since the digests leave out the
+    * timestamps of pvp files, a linked pvp file keeps the timestamps of the checkpoint that
+    * wrote it.
+    */
+   void linkUnchangedFiles(
+         std::string const &previousDirectory,
+         std::map<std::string, FileDigest> &fileDigests);
+
+   /**
+    * Writes the staged files to disk, in the order they were opened, and releases their
+    * contents. Does not use MPI, so it can be called from any thread. An existing file at a
+    * staged path is unlinked first, since it may be a hard link into an older checkpoint.
+    */
+   void writeFiles();
+
+   /**
+    * Returns the number of files staged or linked so far.
+    */
+   std::size_t getNumFiles() const { return mStagedFiles.size(); }
+
+   /**
+    * Returns the path of the file with the given index, in the order the files were opened.
+    */
+   std::string const &getPath(std::size_t index) const { return mStagedFiles.at(index).mPath; }
+
+   /**
+    * Returns the total size in bytes of the staged files.
+    */
+   std::size_t getSize() const;
+
+  private:
+   struct StagedFile {
+      std::string mPath;
+      bool mVerifyWrites;
+      std::shared_ptr<std::vector<char> const> mContents;
+      std::string mLinkTarget; // If nonempty, the file is a hard link to this path.
+   };
+
+   static FileDigest calcDigest(std::vector<char> const &contents);
+
+   /**
+    * If contents is a weight pvp file, or a dense activity pvp file whose size agrees with its
+    * header, returns the offsets of its timestamps: the header's, and for an activity file, the
+    * one that begins each frame. Otherwise returns an empty vector.
+    */
+   static std::vector<std::size_t> findPvpTimestamps(std::vector<char> const &contents);
+   static std::shared_ptr<std::vector<char> const> readFile(std::string const &path);
+
+   std::vector<StagedFile> mStagedFiles;
+};
+
+} // namespace PV
+
+#endif // CHECKPOINTSTAGINGARENA_HPP_
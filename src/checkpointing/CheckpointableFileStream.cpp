@@ -74,17 +74,16 @@ void CheckpointableFileStream::setDescription() {
    description.append(mObjName).append("\"");
 }
 
-Response::Status CheckpointableFileStream::respond(std::shared_ptr<BaseMessage const> message) {
-   auto status = Response::NO_ACTION;
-   if (message == nullptr) {
-      return status;
-   }
-   else if (
-         ProcessCheckpointReadMessage const *castMessage =
-               dynamic_cast<ProcessCheckpointReadMessage const *>(message.get())) {
-      status = respondProcessCheckpointRead(castMessage);
-   }
-   return status;
+void CheckpointableFileStream::initMessageActionMap() {
+   // CheckpointableFileStream only acts on ProcessCheckpointRead, so it does not call
+   // CheckpointerDataInterface::initMessageActionMap().
+   setMessageAction(
+         BaseMessage::messageIdOf<ProcessCheckpointReadMessage>(),
+         [](Observer *observer, std::shared_ptr<BaseMessage const> message) {
+            auto *fileStream  = static_cast<CheckpointableFileStream *>(observer);
+            auto *castMessage = static_cast<ProcessCheckpointReadMessage const *>(message.get());
+            return fileStream->respondProcessCheckpointRead(castMessage);
+         });
 }
 
 Response::Status CheckpointableFileStream::respondProcessCheckpointRead(
@@ -44,13 +44,14 @@ class CheckpointableFileStream : public FileStream, public CheckpointerDataInter
          bool newFile,
          Checkpointer *checkpointer,
          string const &objName);
-   virtual Response::Status respond(std::shared_ptr<BaseMessage const> message) override;
    virtual void write(void const *data, long length) override;
    virtual void read(void *data, long length) override;
    virtual void setOutPos(long pos, bool fromBeginning) override;
    virtual void setInPos(long pos, bool fromBeginning) override;
 
   private:
+   virtual void initMessageActionMap() override;
+
    void initialize(
          string const &path,
          bool newFile,
@@ -13,6 +13,7 @@
 // #include <cmath>
 // #include <cstring>
 #include <fts.h>
+#include <map>
 #include <signal.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -44,6 +45,7 @@ Checkpointer::Checkpointer(
 }
 
 Checkpointer::~Checkpointer() {
+   delete mBackgroundWriter; // waits for a staged checkpoint to be written
    free(mCheckpointWriteDir);
    free(mCheckpointWriteTriggerModeString);
    free(mCheckpointWriteWallclockUnit);
@@ -128,6 +130,9 @@ void Checkpointer::ioParamsFillGroup(enum ParamsIOFlag ioFlag, PVParams *params)
    ioParam_suppressNonplasticCheckpoints(ioFlag, params);
    ioParam_deleteOlderCheckpoints(ioFlag, params);
    ioParam_numCheckpointsKept(ioFlag, params);
+   ioParam_checkpointWriteInBackground(ioFlag, params);
+   ioParam_checkpointWriteCollective(ioFlag, params);
+   ioParam_checkpointWriteIncremental(ioFlag, params);
    ioParam_lastCheckpointDir(ioFlag, params);
    ioParam_initializeFromCheckpointDir(ioFlag, params);
 }
@@ -399,6 +404,52 @@ void Checkpointer::ioParam_numCheckpointsKept(enum ParamsIOFlag ioFlag, PVParams
    }
 }
 
+void Checkpointer::ioParam_checkpointWriteInBackground(
+      enum ParamsIOFlag ioFlag,
+      PVParams *params) {
+   pvAssert(!params->presentAndNotBeenRead(mName.c_str(), "checkpointWrite"));
+   if (mCheckpointWriteFlag) {
+      params->ioParamValue(
+            ioFlag,
+            mName.c_str(),
+            "checkpointWriteInBackground",
+            &mCheckpointWriteInBackground,
+            mCheckpointWriteInBackground);
+      if (ioFlag == PARAMS_IO_READ and mCheckpointWriteInBackground
+          and mBackgroundWriter == nullptr) {
+         mBackgroundWriter = new BackgroundCheckpointWriter();
+      }
+   }
+}
+
+void Checkpointer::ioParam_checkpointWriteCollective(
+      enum ParamsIOFlag ioFlag,
+      PVParams *params) {
+   pvAssert(!params->presentAndNotBeenRead(mName.c_str(), "checkpointWrite"));
+   if (mCheckpointWriteFlag) {
+      params->ioParamValue(
+            ioFlag,
+            mName.c_str(),
+            "checkpointWriteCollective",
+            &mCheckpointWriteCollective,
+            mCheckpointWriteCollective);
+   }
+}
+
+void Checkpointer::ioParam_checkpointWriteIncremental(
+      enum ParamsIOFlag ioFlag,
+      PVParams *params) {
+   pvAssert(!params->presentAndNotBeenRead(mName.c_str(), "checkpointWrite"));
+   if (mCheckpointWriteFlag) {
+      params->ioParamValue(
+            ioFlag,
+            mName.c_str(),
+            "checkpointWriteIncremental",
+            &mCheckpointWriteIncremental,
+            mCheckpointWriteIncremental);
+   }
+}
+
 void Checkpointer::ioParam_checkpointIndexWidth(enum ParamsIOFlag ioFlag, PVParams *params) {
    assert(!params->presentAndNotBeenRead(mName.c_str(), "checkpointWrite"));
    if (mCheckpointWriteFlag) {
@@ -470,6 +521,9 @@ bool Checkpointer::registerCheckpointEntry(
       }
    }
    mCheckpointRegistry.push_back(checkpointEntry);
+   if (constantEntireRun) {
+      mConstantEntryNames.insert(name);
+   }
    return true;
 }
 
@@ -507,6 +561,7 @@ void Checkpointer::readNamedCheckpointEntry(
 
 void Checkpointer::findWarmStartDirectory() {
    char warmStartDirectoryBuffer[PV_PATH_MAX];
+   std::map<long int, std::string> completeCheckpoints;
    if (mMPIBlock->getRank() == 0) {
       if (mCheckpointWriteFlag) {
          // Look for largest indexed Checkpointnnnnnn directory in checkpointWriteDir
@@ -519,31 +574,27 @@ void Checkpointer::findWarmStartDirectory() {
          int statstatus = PV_stat(cpDirString.c_str(), &statbuf);
          if (statstatus == 0) {
             if (statbuf.st_mode & S_IFDIR) {
-               char *dirs[]     = {mCheckpointWriteDir, nullptr};
-               FTS *fts         = fts_open(dirs, FTS_LOGICAL, nullptr);
-               FTSENT *ftsent   = fts_read(fts);
-               bool found       = false;
-               long int cpIndex = LONG_MIN;
-               std::string indexedDir;
+               char *dirs[]   = {mCheckpointWriteDir, nullptr};
+               FTS *fts       = fts_open(dirs, FTS_LOGICAL, nullptr);
+               FTSENT *ftsent = fts_read(fts);
                for (ftsent = fts_children(fts, 0); ftsent != nullptr; ftsent = ftsent->fts_link) {
                   if (ftsent->fts_statp->st_mode & S_IFDIR) {
                      long int x;
                      int k = sscanf(ftsent->fts_name, "Checkpoint%ld", &x);
-                     if (x > cpIndex) {
-                        cpIndex    = x;
-                        indexedDir = ftsent->fts_name;
-                        found      = true;
+                     // A checkpoint without timeinfo.bin was interrupted while being written.
+                     if (k == 1 and isCompleteCheckpoint(cpDirString + ftsent->fts_name)) {
+                        completeCheckpoints.emplace(x, cpDirString + ftsent->fts_name);
                      }
                   }
                }
+               fts_close(fts);
                FatalIf(
-                     !found,
+                     completeCheckpoints.empty(),
                      "restarting but checkpointWriteFlag is set and "
                      "checkpointWriteDir directory \"%s\" does not have any "
-                     "checkpoints\n",
+                     "complete checkpoints\n",
                      mCheckpointWriteDir);
-               mCheckpointReadDirectory = cpDirString;
-               mCheckpointReadDirectory.append(indexedDir);
+               mCheckpointReadDirectory = completeCheckpoints.rbegin()->second;
             }
             else {
                Fatal().printf(
@@ -566,6 +617,29 @@ void Checkpointer::findWarmStartDirectory() {
                "Restart flag set, but unable to determine restart directory.\n");
          mCheckpointReadDirectory = strdup(mLastCheckpointDir);
       }
+   }
+   if (mCheckpointWriteFlag) {
+      // Each block checks its own subdirectories for completeness; if a background write was
+      // interrupted, the blocks may disagree, so use the newest checkpoint complete in all blocks.
+      long int checkpointIndex = LONG_MAX;
+      if (mMPIBlock->getRank() == 0) {
+         checkpointIndex =
+               completeCheckpoints.empty() ? LONG_MIN : completeCheckpoints.rbegin()->first;
+      }
+      MPI_Allreduce(
+            MPI_IN_PLACE, &checkpointIndex, 1, MPI_LONG, MPI_MIN, mMPIBlock->getGlobalComm());
+      if (mMPIBlock->getRank() == 0) {
+         auto found = completeCheckpoints.find(checkpointIndex);
+         FatalIf(
+               found == completeCheckpoints.end(),
+               "restarting but checkpoint %ld, the newest checkpoint complete in all blocks, "
+               "is not complete in \"%s\"\n",
+               checkpointIndex,
+               mCheckpointWriteDir);
+         mCheckpointReadDirectory = found->second;
+      }
+   }
+   if (mMPIBlock->getRank() == 0) {
       FatalIf(
             mCheckpointReadDirectory.size() >= PV_PATH_MAX,
             "Restart flag set, but inferred checkpoint read directory is too long (%zu "
@@ -791,13 +865,20 @@ void Checkpointer::checkpointNow() {
    checkpointToDirectory(checkpointDirectory);
 
    if (mDeleteOlderCheckpoints) {
-      rotateOldCheckpoints(checkpointDirectory);
+      if (mBackgroundWriter) {
+         // Don't delete an older checkpoint until the new one has been written.
+         mBackgroundWriteDirectory = checkpointDirectory;
+      }
+      else {
+         rotateOldCheckpoints(checkpointDirectory);
+      }
    }
 }
 
 void Checkpointer::checkpointToDirectory(std::string const &directory) {
    std::string checkpointDirectory = generateBlockPath(directory);
    mCheckpointTimer->start();
+   finishBackgroundWrite();
    if (mMPIBlock->getRank() == 0) {
       InfoLog() << "Checkpointing to directory \"" << checkpointDirectory
                 << "\" at simTime = " << mTimeInfo.mSimTime << "\n";
@@ -816,20 +897,115 @@ void Checkpointer::checkpointToDirectory(std::string const &directory) {
          std::make_shared<PrepareCheckpointWriteMessage const>(checkpointDirectory),
          mMPIBlock->getRank() == 0 /*printFlag*/);
    ensureDirExists(mMPIBlock, checkpointDirectory.c_str());
-   for (auto &c : mCheckpointRegistry) {
-      c->write(checkpointDirectory, mTimeInfo.mSimTime, mVerifyWrites);
+   if (mPreviousCheckpointDirectory == checkpointDirectory) {
+      // The files cannot be linked to themselves, so rewriting a checkpoint writes it in full.
+      mPreviousCheckpointDirectory.clear();
+   }
+   std::shared_ptr<CheckpointStagingArena> arena = nullptr;
+   if (mBackgroundWriter) {
+      arena = std::make_shared<CheckpointStagingArena>();
+      for (auto &c : mCheckpointRegistry) {
+         stageCheckpointEntry(*c, checkpointDirectory, arena.get());
+      }
+      // Staged last so that it is written last; it marks the checkpoint as complete.
+      mTimeInfoCheckpointEntry->stage(
+            checkpointDirectory, mTimeInfo.mSimTime, mVerifyWrites, arena.get());
+      if (mCheckpointWriteIncremental) {
+         arena->linkUnchangedFiles(mPreviousCheckpointDirectory, mFileDigests);
+      }
+   }
+   else if (mCheckpointWriteIncremental) {
+      for (auto &c : mCheckpointRegistry) {
+         CheckpointStagingArena entryArena;
+         stageCheckpointEntry(*c, checkpointDirectory, &entryArena);
+         entryArena.linkUnchangedFiles(mPreviousCheckpointDirectory, mFileDigests);
+         entryArena.writeFiles();
+      }
+      mTimeInfoCheckpointEntry->write(checkpointDirectory, mTimeInfo.mSimTime, mVerifyWrites);
+   }
+   else if (mCheckpointWriteCollective) {
+      for (auto &c : mCheckpointRegistry) {
+         c->writeCollective(checkpointDirectory, mTimeInfo.mSimTime, mVerifyWrites);
+      }
+      mTimeInfoCheckpointEntry->write(checkpointDirectory, mTimeInfo.mSimTime, mVerifyWrites);
+   }
+   else {
+      for (auto &c : mCheckpointRegistry) {
+         c->write(checkpointDirectory, mTimeInfo.mSimTime, mVerifyWrites);
+      }
+      mTimeInfoCheckpointEntry->write(checkpointDirectory, mTimeInfo.mSimTime, mVerifyWrites);
+   }
+   if (mCheckpointWriteIncremental) {
+      mPreviousCheckpointDirectory = checkpointDirectory;
    }
-   mTimeInfoCheckpointEntry->write(checkpointDirectory, mTimeInfo.mSimTime, mVerifyWrites);
    mCheckpointTimer->stop();
    mCheckpointTimer->start();
    writeTimers(checkpointDirectory);
    mCheckpointTimer->stop();
-   if (mMPIBlock->getRank() == 0) {
+   if (arena) {
+      if (mMPIBlock->getRank() == 0) {
+         InfoLog().printf(
+               "checkpointWrite staged %zu bytes; writing in the background. simTime = %f\n",
+               arena->getSize(),
+               mTimeInfo.mSimTime);
+         InfoLog().flush();
+      }
+      mBackgroundWriter->submit(arena);
+   }
+   else if (mMPIBlock->getRank() == 0) {
       InfoLog().printf("checkpointWrite complete. simTime = %f\n", mTimeInfo.mSimTime);
       InfoLog().flush();
    }
 }
 
+void Checkpointer::stageCheckpointEntry(
+      CheckpointEntry const &checkpointEntry,
+      std::string const &checkpointDirectory,
+      CheckpointStagingArena *arena) {
+   std::string const &name = checkpointEntry.getName();
+   bool const isConstant   = mCheckpointWriteIncremental and mConstantEntryNames.count(name) > 0;
+   // All processes make the same choice here, since staging an entry may require communication.
+   if (isConstant and !mPreviousCheckpointDirectory.empty()) {
+      auto found = mConstantEntryFiles.find(name);
+      if (found != mConstantEntryFiles.end()) {
+         for (auto &fileName : found->second) {
+            arena->linkFile(
+                  checkpointDirectory + "/" + fileName,
+                  mPreviousCheckpointDirectory + "/" + fileName);
+         }
+         return;
+      }
+   }
+   std::size_t const firstFile = arena->getNumFiles();
+   checkpointEntry.stage(checkpointDirectory, mTimeInfo.mSimTime, mVerifyWrites, arena);
+   if (isConstant) {
+      std::vector<std::string> &fileNames = mConstantEntryFiles[name];
+      fileNames.clear();
+      for (std::size_t n = firstFile; n < arena->getNumFiles(); n++) {
+         std::string const &path = arena->getPath(n);
+         fileNames.push_back(path.substr(path.find_last_of('/') + 1));
+      }
+   }
+}
+
+void Checkpointer::finishBackgroundWrite() {
+   if (mBackgroundWriter == nullptr) {
+      return;
+   }
+   mBackgroundWriter->finish();
+   if (!mBackgroundWriteDirectory.empty()) {
+      rotateOldCheckpoints(mBackgroundWriteDirectory);
+      mBackgroundWriteDirectory.clear();
+   }
+}
+
+bool Checkpointer::isCompleteCheckpoint(std::string const &directory) {
+   std::string timeinfoFilename = generateBlockPath(directory);
+   timeinfoFilename.append("/timeinfo.bin");
+   struct stat timeinfostat;
+   return stat(timeinfoFilename.c_str(), &timeinfostat) == 0;
+}
+
 void Checkpointer::finalCheckpoint(double simTime) {
    mTimeInfo.mSimTime = simTime;
    if (mCheckpointWriteFlag) {
@@ -838,6 +1014,9 @@ void Checkpointer::finalCheckpoint(double simTime) {
    else if (mLastCheckpointDir != nullptr && mLastCheckpointDir[0] != '\0') {
       checkpointToDirectory(std::string(mLastCheckpointDir));
    }
+   mCheckpointTimer->start();
+   finishBackgroundWrite();
+   mCheckpointTimer->stop();
 }
 
 void Checkpointer::rotateOldCheckpoints(std::string const &newCheckpointDirectory) {
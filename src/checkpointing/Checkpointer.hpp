@@ -8,6 +8,7 @@
 #ifndef CHECKPOINTER_HPP_
 #define CHECKPOINTER_HPP_
 
+#include "checkpointing/BackgroundCheckpointWriter.hpp"
 #include "checkpointing/CheckpointEntry.hpp"
 #include "checkpointing/CheckpointEntryData.hpp"
 #include "io/PVParams.hpp"
@@ -16,7 +17,8 @@
 // #include "structures/MPIBlock.hpp"
 #include "utils/Timer.hpp"
 #include <ctime>
-// #include <map>
+#include <map>
+#include <set>
 // #include <memory>
 // #include <string>
 
@@ -118,6 +120,49 @@ class Checkpointer : public Subject {
     */
    void ioParam_deleteOlderCheckpoints(enum ParamsIOFlag ioFlag, PVParams *params);
 
+   /**
+    * @brief checkpointWriteInBackground: If checkpointWrite is set, specifies whether the
+    * checkpoint files are written by a background thread.
+    * @details If true, a checkpoint is gathered into memory and the run continues while a
+    * background thread writes the files to disk. The timeinfo files are written last, so that
+    * a checkpoint without them is known to be incomplete and is not used for restarting.
+    * Only one checkpoint is written at a time: the next checkpoint, and the end of the run,
+    * wait for the previous one to finish. When deleteOlderCheckpoints is set, older
+    * checkpoints are deleted only after the newer one is complete.
+    * The default is false.
+    */
+   void ioParam_checkpointWriteInBackground(enum ParamsIOFlag ioFlag, PVParams *params);
+
+   /**
+    * @brief checkpointWriteCollective: If checkpointWrite is set, specifies whether layer
+    * activity and other pvp checkpoint files are written with MPI-IO.
+    * @details If true, each process writes its own part of a pvp checkpoint file, using
+    * collective MPI-IO calls, instead of sending its data to the root process of its
+    * checkpoint block, which then writes the whole file. The files are identical either way.
+    * The checkpoint directory must be on a file system that all processes in a block share.
+    * Weights are still gathered to the root process. If checkpointWriteInBackground is set,
+    * it takes precedence, since staging a checkpoint requires the root process to have all
+    * the data. The default is false.
+    */
+   void ioParam_checkpointWriteCollective(enum ParamsIOFlag ioFlag, PVParams *params);
+
+   /**
+    * @brief checkpointWriteIncremental: If checkpointWrite is set, specifies whether a checkpoint
+    * writes only the files that have changed since the previous checkpoint of the run.
+    * @details If true, a file whose contents are the same as in the previous checkpoint, apart
+    * from the timestamps in a pvp file, is made a hard link to that file instead of being written
+    * again. Entries that were registered as constant for the entire run (for example, the
+    * weights of connections that are not plastic) are written only by the first checkpoint of
+    * the run; later checkpoints link to their files without gathering the data. Linked pvp files
+    * therefore keep the timestamps of the checkpoint that wrote them, which restarting does not
+    * use. Since each checkpoint holds its own links, deleting older checkpoints does not affect
+    * newer ones. The first checkpoint after a restart is written in full. Unless
+    * checkpointWriteInBackground is set, an incremental checkpoint is staged in memory one entry
+    * at a time. checkpointWriteCollective has no effect when this flag is set. The default is
+    * false.
+    */
+   void ioParam_checkpointWriteIncremental(enum ParamsIOFlag ioFlag, PVParams *params);
+
    /**
     * @brief mNumCheckpointsKept: If mDeleteOlderCheckpoints is set,
     * keep this many checkpoints before deleting the checkpoint.
@@ -284,9 +329,35 @@ class Checkpointer : public Subject {
     * Creates a checkpoint based at the given directory. If the checkpoint directory already exists,
     * it issues a warning, and deletes the timeinfo.bin file in the checkpooint. This way, the
     * presence of the timeinfo.bin file indicates that the checkpoint is complete.
+    * If checkpointWriteInBackground is set, the checkpoint is staged in memory and handed to the
+    * background writer, and this method returns without waiting for the files to be written.
     */
    void checkpointToDirectory(std::string const &checkpointDirectory);
 
+   /**
+    * Stages the given entry into the arena. If checkpointWriteIncremental is set and the entry
+    * is constant for the run and has already been written, its files are linked to the previous
+    * checkpoint instead.
+    */
+   void stageCheckpointEntry(
+         CheckpointEntry const &checkpointEntry,
+         std::string const &checkpointDirectory,
+         CheckpointStagingArena *arena);
+
+   /**
+    * Waits for the background writer to finish writing any staged checkpoint, and then rotates
+    * the checkpoint into the list of older checkpoints if deleteOlderCheckpoints is set.
+    * Does nothing if checkpointWriteInBackground is not set. All processes must call this
+    * method together, since rotating old checkpoints requires a barrier.
+    */
+   void finishBackgroundWrite();
+
+   /**
+    * Returns true if the given checkpoint directory has a timeinfo.bin file in this process's
+    * block subdirectory.
+    */
+   bool isCompleteCheckpoint(std::string const &directory);
+
    /**
     * Called if deleteOlderCheckpoints is true. It deletes the oldest checkpoint in the list of
     * old checkpoint directories, and adds the new checkpoint directory to the list.
@@ -322,6 +393,18 @@ class Checkpointer : public Subject {
    int mCheckpointIndexWidth                                               = -1;
    bool mSuppressNonplasticCheckpoints                                     = false;
    bool mDeleteOlderCheckpoints                                            = false;
+   bool mCheckpointWriteInBackground                                       = false;
+   bool mCheckpointWriteCollective                                         = false;
+   bool mCheckpointWriteIncremental                                        = false;
+   BackgroundCheckpointWriter *mBackgroundWriter                           = nullptr;
+   std::string mBackgroundWriteDirectory; // The staged checkpoint that is to be rotated when done.
+
+   // Used if mCheckpointWriteIncremental is true. The files of the constant entries are keyed by
+   // entry name; an entry has a key once it has been written. The digests are keyed by file name.
+   std::set<std::string> mConstantEntryNames;
+   std::map<std::string, std::vector<std::string>> mConstantEntryFiles;
+   std::map<std::string, CheckpointStagingArena::FileDigest> mFileDigests;
+   std::string mPreviousCheckpointDirectory;
    int mNumCheckpointsKept                                                 = 2;
    char *mLastCheckpointDir                                                = nullptr;
    char *mInitializeFromCheckpointDir                                      = nullptr;
@@ -9,35 +9,12 @@
 
 namespace PV {
 
-Response::Status CheckpointerDataInterface::respond(std::shared_ptr<BaseMessage const> message) {
-   auto status = Response::NO_ACTION;
-   if (message == nullptr) {
-      return status;
-   }
-   else if (
-         auto castMessage =
-               std::dynamic_pointer_cast<RegisterDataMessage<Checkpointer> const>(message)) {
-      return respondRegisterData(castMessage);
-   }
-   else if (
-         auto castMessage =
-               std::dynamic_pointer_cast<ReadStateFromCheckpointMessage<Checkpointer> const>(
-                     message)) {
-      return respondReadStateFromCheckpoint(castMessage);
-   }
-   else if (
-         auto castMessage =
-               std::dynamic_pointer_cast<ProcessCheckpointReadMessage const>(message)) {
-      return respondProcessCheckpointRead(castMessage);
-   }
-   else if (
-         auto castMessage =
-               std::dynamic_pointer_cast<PrepareCheckpointWriteMessage const>(message)) {
-      return respondPrepareCheckpointWrite(castMessage);
-   }
-   else {
-      return status;
-   }
+void CheckpointerDataInterface::initMessageActionMap() {
+   Observer::initMessageActionMap();
+   setMessageAction(&CheckpointerDataInterface::respondRegisterData);
+   setMessageAction(&CheckpointerDataInterface::respondReadStateFromCheckpoint);
+   setMessageAction(&CheckpointerDataInterface::respondProcessCheckpointRead);
+   setMessageAction(&CheckpointerDataInterface::respondPrepareCheckpointWrite);
 }
 
 Response::Status CheckpointerDataInterface::respondRegisterData(
@@ -46,8 +46,6 @@ class CheckpointerDataInterface : public Observer {
   public:
    virtual Response::Status registerData(Checkpointer *checkpointer);
 
-   virtual Response::Status respond(std::shared_ptr<BaseMessage const> message) override;
-
    virtual Response::Status readStateFromCheckpoint(Checkpointer *checkpointer) {
       return Response::NO_ACTION;
    }
@@ -55,6 +53,8 @@ class CheckpointerDataInterface : public Observer {
    MPIBlock const *getMPIBlock() { return mMPIBlock; }
 
   protected:
+   virtual void initMessageActionMap() override;
+
    Response::Status
    respondRegisterData(std::shared_ptr<RegisterDataMessage<Checkpointer> const> message);
    Response::Status respondReadStateFromCheckpoint(
@@ -81,41 +81,16 @@ void BaseObject::ioParams(enum ParamsIOFlag ioFlag, bool printHeader, bool print
    }
 }
 
-Response::Status BaseObject::respond(std::shared_ptr<BaseMessage const> message) {
-   // TODO: convert PV_SUCCESS, PV_FAILURE, etc. to enum
-   Response::Status status = CheckpointerDataInterface::respond(message);
-   if (!Response::completed(status)) {
-      return status;
-   }
-   if (message == nullptr) {
-      return Response::NO_ACTION;
-   }
-   else if (
-         auto castMessage = std::dynamic_pointer_cast<CommunicateInitInfoMessage const>(message)) {
-      return respondCommunicateInitInfo(castMessage);
-   }
+void BaseObject::initMessageActionMap() {
+   CheckpointerDataInterface::initMessageActionMap();
+   setMessageAction(&BaseObject::respondCommunicateInitInfo);
 #ifdef PV_USE_CUDA
-   else if (auto castMessage = std::dynamic_pointer_cast<SetCudaDeviceMessage const>(message)) {
-      return respondSetCudaDevice(castMessage);
-   }
+   setMessageAction(&BaseObject::respondSetCudaDevice);
 #endif // PV_USE_CUDA
-   else if (auto castMessage = std::dynamic_pointer_cast<AllocateDataMessage const>(message)) {
-      return respondAllocateData(castMessage);
-   }
-   else if (auto castMessage = std::dynamic_pointer_cast<InitializeStateMessage const>(message)) {
-      return respondInitializeState(castMessage);
-   }
-   else if (
-         auto castMessage =
-               std::dynamic_pointer_cast<CopyInitialStateToGPUMessage const>(message)) {
-      return respondCopyInitialStateToGPU(castMessage);
-   }
-   else if (auto castMessage = std::dynamic_pointer_cast<CleanupMessage const>(message)) {
-      return respondCleanup(castMessage);
-   }
-   else {
-      return Response::SUCCESS;
-   }
+   setMessageAction(&BaseObject::respondAllocateData);
+   setMessageAction(&BaseObject::respondInitializeState);
+   setMessageAction(&BaseObject::respondCopyInitialStateToGPU);
+   setMessageAction(&BaseObject::respondCleanup);
 }
 
 Response::Status
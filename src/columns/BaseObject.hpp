@@ -82,9 +82,6 @@ class BaseObject : public CheckpointerDataInterface {
     */
    void ioParams(enum ParamsIOFlag ioFlag, bool printHeader, bool printFooter);
 
-   virtual Response::Status respond(std::shared_ptr<BaseMessage const> message) override;
-   // TODO: should return enum with values corresponding to PV_SUCCESS, PV_FAILURE, PV_POSTPONE
-
    virtual ~BaseObject();
 
    /**
@@ -117,6 +114,8 @@ class BaseObject : public CheckpointerDataInterface {
 #endif // PV_USE_CUDA
 
   protected:
+   virtual void initMessageActionMap() override;
+
    BaseObject();
    int initialize(char const *name, HyPerCol *hc);
    int setName(char const *name);
@@ -10,29 +10,128 @@
 #include "utils/PVAssert.hpp"
 #include "utils/PVLog.hpp"
 
+#include <algorithm>
 #include <limits>
+#include <vector>
+
+#ifdef PV_USE_OPENMP_THREADS
+#include <omp.h>
+#endif // PV_USE_OPENMP_THREADS
 
 namespace PV {
 
-DataStore::DataStore(int numBuffers, int numItems, int numLevels, bool isSparse_flag) {
+DataStore::DataStore(
+      int numBuffers,
+      int numItems,
+      int numLevels,
+      bool isSparse_flag,
+      float *sharedBuffer,
+      bool compactLevels) {
    assert(numLevels > 0 && numBuffers > 0);
+   assert(sharedBuffer == nullptr || numLevels == 1);
+   assert(!compactLevels || (isSparse_flag && sharedBuffer == nullptr));
    mCurrentLevel = 0; // Publisher::publish decrements levels when writing, so
    // first level written
    // to is numLevels - 1;
    mNumItems   = numItems;
    mNumLevels  = numLevels;
    mNumBuffers = numBuffers;
+   // With a single level there is nothing to compact.
+   mCompactLevels           = compactLevels && numLevels > 1;
+   int const numDenseLevels = mCompactLevels ? 1 : numLevels;
 
-   mBuffer          = new RingBuffer<float>(numLevels, numBuffers * numItems);
+   if (sharedBuffer) {
+      mSharedBuffer = sharedBuffer;
+   }
+   else {
+      mBuffer = new RingBuffer<float>(numDenseLevels, numBuffers * numItems);
+   }
    mLastUpdateTimes = new RingBuffer<double>(
          numLevels, numBuffers, -std::numeric_limits<double>::infinity() /*initial value*/);
 
    mSparseFlag = isSparse_flag;
    if (mSparseFlag) {
-      mActiveIndices =
-            new RingBuffer<SparseList<float>::Entry>(numLevels, numBuffers * numItems, {0, 0});
+      mActiveIndices = new RingBuffer<SparseList<float>::Entry>(
+            numDenseLevels, numBuffers * numItems, {0, 0});
       mNumActive = new RingBuffer<long>(numLevels, numBuffers);
    }
+   if (mCompactLevels) {
+      mPastActiveIndices =
+            new RingBuffer<std::vector<SparseList<float>::Entry>>(numLevels, numBuffers);
+      mLevelCopies.resize(numLevels);
+   }
+}
+
+void DataStore::newLevelIndex() {
+   if (mCompactLevels) {
+      // Keep the current level's active indices, which become level 1's. The level 0 entry of
+      // mPastActiveIndices is unused until then.
+      for (int b = 0; b < mNumBuffers; b++) {
+         long const numActive = *numActiveBuffer(b, 0);
+         pvAssert(numActive >= 0L);
+         SparseList<float>::Entry const *current = activeIndicesBuffer(b, 0);
+         mPastActiveIndices->getBuffer(0, b)->assign(current, current + numActive);
+      }
+      mPastActiveIndices->newLevel();
+      mLastUpdateTimes->newLevel();
+      mNumActive->newLevel();
+      // The single dense level is not rotated, so it still holds level 1's data.
+      for (int b = 0; b < mNumBuffers; b++) {
+         mPastActiveIndices->getBuffer(0, b)->clear();
+         *numActiveBuffer(b, 0) = *numActiveBuffer(b, 1);
+      }
+      mGeneration++;
+   }
+   else {
+      if (mBuffer) {
+         mBuffer->newLevel();
+      }
+      mLastUpdateTimes->newLevel();
+      if (isSparse()) {
+         mNumActive->newLevel();
+         mActiveIndices->newLevel();
+      }
+   }
+   mCurrentLevel = (mNumLevels + mCurrentLevel - 1) % mNumLevels;
+}
+
+DataStore::LevelCopy &DataStore::levelCopy(int level) {
+   pvAssert(mCompactLevels and level > 0 and level < mNumLevels);
+   std::lock_guard<std::mutex> lock(mLevelCopyMutex);
+   LevelCopy &copy = mLevelCopies[level];
+   if (copy.generation == mGeneration) {
+      return copy;
+   }
+   if (copy.data.empty()) {
+      copy.data.resize(mNumBuffers * mNumItems, 0.0f);
+      copy.activeIndices.resize(mNumBuffers * mNumItems, {0, 0});
+      copy.numActive.resize(mNumBuffers, 0L);
+   }
+   for (int b = 0; b < mNumBuffers; b++) {
+      float *data                       = &copy.data[b * mNumItems];
+      SparseList<float>::Entry *entries = &copy.activeIndices[b * mNumItems];
+      for (long n = 0L; n < copy.numActive[b]; n++) {
+         data[entries[n].index] = 0.0f;
+      }
+      auto const &past = *mPastActiveIndices->getBuffer(level, b);
+      pvAssert(*numActiveBuffer(b, level) == (long)past.size());
+      std::copy(past.begin(), past.end(), entries);
+      for (auto const &entry : past) {
+         data[entry.index] = entry.value;
+      }
+      copy.numActive[b] = (long)past.size();
+   }
+   copy.generation = mGeneration;
+   return copy;
+}
+
+void DataStore::releaseLevelCopies() {
+   for (auto &copy : mLevelCopies) {
+      std::vector<float>().swap(copy.data);
+      std::vector<SparseList<float>::Entry>().swap(copy.activeIndices);
+      std::vector<long>().swap(copy.numActive);
+      copy.generation = -1L;
+   }
 }
 
 void DataStore::markActiveIndicesOutOfSync(int bufferId, int level) {
@@ -47,22 +146,117 @@ void DataStore::updateActiveIndices(int bufferId, int level) {
    if (!mSparseFlag) {
       return;
    }
-   int numActive   = 0;
-   float *activity = buffer(bufferId, level);
-
-   SparseList<float>::Entry *activeIndices = activeIndicesBuffer(bufferId, level);
-   //   unsigned int *activeIndices = activeIndicesBuffer(bufferId, level);
-   for (int kex = 0; kex < getNumItems(); kex++) {
-      float a = activity[kex];
-      if (a != 0.0f) {
-         activeIndices[numActive].index = kex;
-         activeIndices[numActive].value = a;
-         numActive++;
+   long *numActiveBuf = numActiveBuffer(bufferId, level);
+   if (mCompactLevels and level > 0) {
+      // The active indices are the level's only record, unless the copy is current and may
+      // have been written to.
+      LevelCopy &copy = mLevelCopies[level];
+      auto &past      = *mPastActiveIndices->getBuffer(level, bufferId);
+      if (copy.generation == mGeneration) {
+         SparseList<float>::Entry *entries = &copy.activeIndices[bufferId * mNumItems];
+         copy.numActive[bufferId]          = compactActiveIndices(
+               &copy.data[bufferId * mNumItems],
+               1 /*numRows*/,
+               getNumItems(),
+               getNumItems(),
+               0 /*firstIndex*/,
+               entries);
+         past.assign(entries, entries + copy.numActive[bufferId]);
       }
+      *numActiveBuf = (long)past.size();
+      return;
    }
+   *numActiveBuf = compactActiveIndices(
+         buffer(bufferId, level),
+         1 /*numRows*/,
+         getNumItems(),
+         getNumItems(),
+         0 /*firstIndex*/,
+         activeIndicesBuffer(bufferId, level));
+}
 
-   long *numActiveBuf = numActiveBuffer(bufferId, level);
-   *numActiveBuf      = numActive;
+// Calls visit(index, value) for each nonzero value in positions begin through end - 1 of the
+// region described in compactActiveIndices(), in order of increasing position.
+template <typename Visitor>
+static void visitNonzeroValues(
+      float const *data,
+      long begin,
+      long end,
+      int rowLength,
+      int rowStride,
+      int firstIndex,
+      Visitor &visit) {
+   long row    = begin / rowLength;
+   long column = begin % rowLength;
+   for (long k = begin; k < end; row++) {
+      long const rowStart = firstIndex + row * rowStride;
+      long const count    = std::min(rowLength - column, end - k);
+      for (long index = rowStart + column; index < rowStart + column + count; index++) {
+         float const a = data[index];
+         if (a != 0.0f) {
+            visit(index, a);
+         }
+      }
+      k += count;
+      column = 0;
+   }
+}
+
+long DataStore::compactActiveIndices(
+      float const *data,
+      int numRows,
+      int rowLength,
+      int rowStride,
+      int firstIndex,
+      SparseList<float>::Entry *activeIndices) {
+   long const numValues = (long)numRows * (long)rowLength;
+#ifdef PV_USE_OPENMP_THREADS
+   int const maxThreads = omp_get_max_threads();
+#else
+   int const maxThreads = 1;
+#endif // PV_USE_OPENMP_THREADS
+   // threadStart[t] is where thread t writes its entries; threadStart[maxThreads] is the total.
+   std::vector<long> threadStart(maxThreads + 1, 0L);
+
+// Small regions are not worth the cost of starting a parallel region.
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel if (numValues >= 65536L)
+#endif // PV_USE_OPENMP_THREADS
+   {
+#ifdef PV_USE_OPENMP_THREADS
+      int const numThreads = omp_get_num_threads();
+      int const thread     = omp_get_thread_num();
+#else
+      int const numThreads = 1;
+      int const thread     = 0;
+#endif // PV_USE_OPENMP_THREADS
+      long const begin = numValues * thread / numThreads;
+      long const end   = numValues * (thread + 1) / numThreads;
+
+      long count     = 0L;
+      auto countOnly = [&count](long index, float a) { count++; };
+      visitNonzeroValues(data, begin, end, rowLength, rowStride, firstIndex, countOnly);
+      threadStart[thread + 1] = count;
+
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp barrier
+#pragma omp single
+#endif // PV_USE_OPENMP_THREADS
+      for (int t = 0; t < maxThreads; t++) {
+         threadStart[t + 1] += threadStart[t];
+      }
+      // The implicit barrier at the end of the single construct makes the prefix sum
+      // visible to all threads.
+
+      long n          = threadStart[thread];
+      auto writeEntry = [activeIndices, &n](long index, float a) {
+         activeIndices[n].index = (uint32_t)index;
+         activeIndices[n].value = a;
+         n++;
+      };
+      visitNonzeroValues(data, begin, end, rowLength, rowStride, firstIndex, writeEntry);
+   }
+   return threadStart[maxThreads];
 }
 
 PVLayerCube DataStore::createCube(PVLayerLoc const &loc, int delay) {
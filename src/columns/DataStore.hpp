@@ -15,39 +15,77 @@
 #include "structures/SparseList.hpp"
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
+#include <vector>
 
 namespace PV {
 
 class DataStore {
   public:
-   DataStore(int numBuffers, int numItems, int numLevels, bool isSparse);
+   /**
+    * If sharedBuffer is not null, the store has a single level, whose data is the
+    * numBuffers * numItems values beginning at sharedBuffer, owned by the caller.
+    *
+    * If compactLevels is true (which requires a sparse store), only the current level is kept
+    * as a dense buffer. Each of the other levels is kept as its list of active indices, which
+    * for a sparse layer is much smaller, and buffer(), activeIndicesBuffer() and createCube()
+    * for such a level return a dense copy, made when first asked for after the levels rotate.
+    * The copies must not be written to, except as described for updateActiveIndices().
+    *
+    * Making the copy on first request is serialized by a lock, so buffer(), activeIndicesBuffer()
+    * and createCube() may be called for the same level from several threads at once, as
+    * concurrent layer updates do. Nothing else about the copies is thread-safe: newLevelIndex(),
+    * updateActiveIndices() and releaseLevelCopies() must not run while another thread is using
+    * the store.
+    */
+   DataStore(
+         int numBuffers,
+         int numItems,
+         int numLevels,
+         bool isSparse,
+         float *sharedBuffer = nullptr,
+         bool compactLevels  = false);
 
    virtual ~DataStore() {
       delete mBuffer;
       delete mLastUpdateTimes;
       delete mNumActive;
       delete mActiveIndices;
+      delete mPastActiveIndices;
    }
 
    int getNumLevels() const { return mNumLevels; }
    int getNumBuffers() const { return mNumBuffers; }
-   void newLevelIndex() {
-      mBuffer->newLevel();
-      mLastUpdateTimes->newLevel();
-      if (isSparse()) {
-         mNumActive->newLevel();
-         mActiveIndices->newLevel();
-      }
-      mCurrentLevel = (mNumLevels + mCurrentLevel - 1) % mNumLevels;
-   }
+
+   /**
+    * Rotates the levels, so that level n becomes level n + 1, and the oldest level becomes the
+    * current level. In a compact store, the current level's active indices must be in sync;
+    * the current level then keeps the same data as the new level 1 until it is written.
+    */
+   void newLevelIndex();
 
    // Level (delay) spins slower than bufferId (batch element)
 
    float *buffer(int bufferId, int level) {
+      if (mSharedBuffer) {
+         return &mSharedBuffer[bufferId * mNumItems];
+      }
+      if (mCompactLevels and level > 0) {
+         return &levelCopy(level).data[bufferId * mNumItems];
+      }
       return mBuffer->getBuffer(level, bufferId * mNumItems);
    }
 
-   float *buffer(int bufferId) { return mBuffer->getBuffer(bufferId * mNumItems); }
+   float *buffer(int bufferId) {
+      if (mSharedBuffer) {
+         return &mSharedBuffer[bufferId * mNumItems];
+      }
+      return mBuffer->getBuffer(bufferId * mNumItems);
+   }
+
+   bool isSharingBuffer() const { return mSharedBuffer != nullptr; }
+
+   bool hasCompactLevels() const { return mCompactLevels; }
 
    double getLastUpdateTime(int bufferId, int level) const {
       return *mLastUpdateTimes->getBuffer(level, bufferId);
@@ -64,6 +102,9 @@ class DataStore {
    bool isSparse() const { return mSparseFlag; }
 
    SparseList<float>::Entry *activeIndicesBuffer(int bufferId, int level) {
+      if (mCompactLevels and level > 0) {
+         return &levelCopy(level).activeIndices[bufferId * mNumItems];
+      }
       return mActiveIndices->getBuffer(level, bufferId * mNumItems);
    }
 
@@ -71,6 +112,19 @@ class DataStore {
       return mActiveIndices->getBuffer(bufferId * mNumItems);
    }
 
+   /**
+    * Returns the active indices of the given level, like activeIndicesBuffer(), except that for
+    * a level other than the current one of a compact store, it returns the level's own list
+    * instead of making a dense copy. The list has *numActiveBuffer(bufferId, level) entries,
+    * which must be in sync, and stays valid until the levels rotate.
+    */
+   SparseList<float>::Entry const *activeList(int bufferId, int level) {
+      if (mCompactLevels and level > 0) {
+         return mPastActiveIndices->getBuffer(level, bufferId)->data();
+      }
+      return mActiveIndices->getBuffer(level, bufferId * mNumItems);
+   }
+
    void setNumActive(int bufferId, long numActive) { *mNumActive->getBuffer(bufferId) = numActive; }
 
    long *numActiveBuffer(int bufferId, int level) { return mNumActive->getBuffer(level, bufferId); }
@@ -79,28 +133,89 @@ class DataStore {
 
    void markActiveIndicesOutOfSync(int bufferId, int level);
 
+   /**
+    * Sets the active indices of the given level from its data. In a compact store, to change a
+    * level other than the current one, write into the copy that buffer() returns, and then call
+    * markActiveIndicesOutOfSync() and updateActiveIndices(), before the levels rotate or the
+    * copies are released.
+    */
    void updateActiveIndices(int bufferId, int level);
 
+   /**
+    * Frees the dense copies of the levels of a compact store, which are made again when next
+    * asked for. Use this after reading every level, as checkpointing does, so that the copies
+    * of levels that no connection reads are not kept.
+    */
+   void releaseLevelCopies();
+
+   /**
+    * Writes the nonzero values of a region of a buffer, and their indices, to activeIndices
+    * in increasing order of index, and returns the number of nonzero values. The region
+    * consists of numRows rows of rowLength consecutive values; row r begins at index
+    * firstIndex + r * rowStride. Each thread counts the nonzero values in a contiguous
+    * chunk of the region; a prefix sum of the counts then gives each thread the position
+    * where it writes its chunk's entries.
+    */
+   static long compactActiveIndices(
+         float const *data,
+         int numRows,
+         int rowLength,
+         int rowStride,
+         int firstIndex,
+         SparseList<float>::Entry *activeIndices);
+
    int getNumItems() const { return mNumItems; }
 
    /**
     * Returns a PVLayerCube pointing to the data at the given delay.
     * It does not check whether the PVLayerLoc is consistent with the
     * DataStore's numItems or numBuffers.
+    * In a compact store, the cube of a delay other than zero points to the dense copy of that
+    * level, which stays valid until the levels rotate.
     */
    PVLayerCube createCube(PVLayerLoc const &loc, int delay);
 
+  private:
+   /**
+    * A dense copy of a level of a compact store, in the layout of the other levels of a store
+    * that is not compact. The copy is current if generation is mGeneration.
+    */
+   struct LevelCopy {
+      std::vector<float> data;
+      std::vector<SparseList<float>::Entry> activeIndices;
+      std::vector<long> numActive;
+      long generation = -1L;
+   };
+
+   /**
+    * Returns the dense copy of the given level of a compact store, bringing it up to date
+    * from the level's active indices if the levels have rotated since it was made. Only the
+    * values that were nonzero in the copy's previous contents are cleared. Holds
+    * mLevelCopyMutex while checking and refreshing the copy.
+    */
+   LevelCopy &levelCopy(int level);
+
   private:
    int mNumItems;
    int mCurrentLevel;
    int mNumLevels;
    int mNumBuffers;
    bool mSparseFlag;
+   bool mCompactLevels = false;
 
    RingBuffer<float> *mBuffer                           = nullptr;
+   float *mSharedBuffer                                 = nullptr;
    RingBuffer<double> *mLastUpdateTimes                 = nullptr;
    RingBuffer<long> *mNumActive                         = nullptr;
    RingBuffer<SparseList<float>::Entry> *mActiveIndices = nullptr;
+
+   // In a compact store, mBuffer and mActiveIndices have only the current level; the active
+   // indices of the other levels are in mPastActiveIndices, each sized to its number of
+   // active values.
+   RingBuffer<std::vector<SparseList<float>::Entry>> *mPastActiveIndices = nullptr;
+   std::vector<LevelCopy> mLevelCopies;
+   long mGeneration = 0L; // Advanced each time the levels rotate.
+   std::mutex mLevelCopyMutex;
 };
 
 } // NAMESPACE
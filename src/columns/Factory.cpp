@@ -88,9 +88,12 @@
 
 #include "delivery/IdentDelivery.hpp"
 #include "delivery/PostsynapticPerspectiveConvolveDelivery.hpp"
+#include "delivery/PostsynapticPerspectiveGemmDelivery.hpp"
 #include "delivery/PostsynapticPerspectiveStochasticDelivery.hpp"
 #include "delivery/PresynapticPerspectiveConvolveDelivery.hpp"
+#include "delivery/PresynapticPerspectiveSparseDelivery.hpp"
 #include "delivery/PresynapticPerspectiveStochasticDelivery.hpp"
+#include "delivery/PresynapticPerspectiveTiledDelivery.hpp"
 #include "delivery/RescaleDelivery.hpp"
 #include "delivery/WTADelivery.hpp"
 
@@ -209,15 +212,24 @@ int Factory::registerCoreKeywords() {
    registerKeyword(
          "PostsynapticPerspectiveConvolveDelivery",
          Factory::create<PostsynapticPerspectiveConvolveDelivery>);
+   registerKeyword(
+         "PostsynapticPerspectiveGemmDelivery",
+         Factory::create<PostsynapticPerspectiveGemmDelivery>);
    registerKeyword(
          "PostsynapticPerspectiveStochasticDelivery",
          Factory::create<PostsynapticPerspectiveStochasticDelivery>);
    registerKeyword(
          "PresynapticPerspectiveConvolveDelivery",
          Factory::create<PresynapticPerspectiveConvolveDelivery>);
+   registerKeyword(
+         "PresynapticPerspectiveSparseDelivery",
+         Factory::create<PresynapticPerspectiveSparseDelivery>);
    registerKeyword(
          "PresynapticPerspectiveStochasticDelivery",
          Factory::create<PresynapticPerspectiveStochasticDelivery>);
+   registerKeyword(
+         "PresynapticPerspectiveTiledDelivery",
+         Factory::create<PresynapticPerspectiveTiledDelivery>);
    registerKeyword("RescaleDelivery", Factory::create<RescaleDelivery>);
    registerKeyword("WTADelivery", Factory::create<WTADelivery>);
 #ifdef PV_USE_CUDA
@@ -14,8 +14,10 @@
 #include "columns/RandomSeed.hpp"
 #include "io/PrintStream.hpp"
 #include "io/io.hpp"
+#include "layers/HyPerLayer.hpp"
 #include "pvGitRevision.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <cmath>
 #include <csignal>
@@ -100,9 +102,10 @@ int HyPerCol::initialize_base() {
    mCommunicator             = nullptr;
    mRunTimer                 = nullptr;
    mPhaseRecvTimers.clear();
-   mRandomSeed        = 0U;
-   mErrorOnNotANumber = false;
-   mNumThreads        = 1;
+   mRandomSeed             = 0U;
+   mErrorOnNotANumber      = false;
+   mConcurrentLayerUpdates = false;
+   mNumThreads             = 1;
 #ifdef PV_USE_CUDA
    mCudaDevice = nullptr;
 #endif
@@ -263,6 +266,7 @@ int HyPerCol::ioParamsFillGroup(enum ParamsIOFlag ioFlag) {
    ioParam_ny(ioFlag);
    ioParam_nBatch(ioFlag);
    ioParam_errorOnNotANumber(ioFlag);
+   ioParam_concurrentLayerUpdates(ioFlag);
 
    return PV_SUCCESS;
 }
@@ -358,6 +362,15 @@ void HyPerCol::ioParam_errorOnNotANumber(enum ParamsIOFlag ioFlag) {
          ioFlag, mName, "errorOnNotANumber", &mErrorOnNotANumber, mErrorOnNotANumber);
 }
 
+void HyPerCol::ioParam_concurrentLayerUpdates(enum ParamsIOFlag ioFlag) {
+   parameters()->ioParamValue(
+         ioFlag,
+         mName,
+         "concurrentLayerUpdates",
+         &mConcurrentLayerUpdates,
+         mConcurrentLayerUpdates);
+}
+
 void HyPerCol::allocateColumn() {
    if (mReadyFlag) {
       return;
@@ -601,6 +614,7 @@ int HyPerCol::processParams(char const *path) {
    if (!mParamsProcessedFlag) {
       auto const &objectMap = mObjectHierarchy.getObjectMap();
       notifyLoop(std::make_shared<CommunicateInitInfoMessage>(objectMap));
+      buildLayerUpdateSchedule();
    }
 
    // Print a cleaned up version of params to the file given by
@@ -621,6 +635,37 @@ int HyPerCol::processParams(char const *path) {
    return PV_SUCCESS;
 }
 
+void HyPerCol::buildLayerUpdateSchedule() {
+   mLayerUpdateSchedule.clear();
+   for (auto &obj : mObjectHierarchy.getObjectVector()) {
+      auto *layer = dynamic_cast<HyPerLayer *>(obj);
+      if (layer == nullptr) {
+         continue;
+      }
+      int const phase = layer->getPhase();
+      if (phase >= (int)mLayerUpdateSchedule.size()) {
+         mLayerUpdateSchedule.resize(phase + 1);
+      }
+      auto &phaseSchedule = mLayerUpdateSchedule[phase];
+
+      // A dependency in either direction means the two layers update in hierarchy order,
+      // the same order in which updating one layer at a time would visit them.
+      LayerUpdateTask task;
+      task.mLayer              = layer;
+      auto const &dependencies = layer->getUpdateDependencies();
+      for (int n = 0; n < (int)phaseSchedule.size(); n++) {
+         HyPerLayer *earlierLayer       = phaseSchedule[n].mLayer;
+         auto const &earlierDependences = earlierLayer->getUpdateDependencies();
+         if (std::find(dependencies.begin(), dependencies.end(), earlierLayer) != dependencies.end()
+             or std::find(earlierDependences.begin(), earlierDependences.end(), layer)
+                      != earlierDependences.end()) {
+            task.mPredecessors.push_back(n);
+         }
+      }
+      phaseSchedule.push_back(task);
+   }
+}
+
 void HyPerCol::advanceTimeLoop(Clock &runClock, int const runClockStartingStep) {
    // time loop
    //
@@ -673,10 +718,10 @@ int HyPerCol::advanceTime(double sim_time) {
    for (int phase = 0; phase < mNumPhases; phase++) {
       notifyLoop(std::make_shared<LayerClearProgressFlagsMessage>());
 
+#ifdef PV_USE_CUDA
       // nonblockingLayerUpdate allows for more concurrency than notifyLoop.
       bool someLayerIsPending = false;
       bool someLayerHasActed  = false;
-#ifdef PV_USE_CUDA
       // Ordering needs to go recvGpu, if(recvGpu and upGpu)update, recvNoGpu,
       // update rest
       auto recvMessage = std::make_shared<LayerRecvSynapticInputMessage>(
@@ -746,16 +791,7 @@ int HyPerCol::advanceTime(double sim_time) {
                   &someLayerIsPending,
                   &someLayerHasActed));
 #else
-      auto recvMessage = std::make_shared<LayerRecvSynapticInputMessage>(
-            phase,
-            mPhaseRecvTimers.at(phase),
-            mSimTime,
-            mDeltaTime,
-            &someLayerIsPending,
-            &someLayerHasActed);
-      auto updateMessage = std::make_shared<LayerUpdateStateMessage>(
-            phase, mSimTime, mDeltaTime, &someLayerIsPending, &someLayerHasActed);
-      nonblockingLayerUpdate(recvMessage, updateMessage);
+      updateLayers(phase);
 #endif
       // Rotate DataStore ring buffers
       notifyLoop(std::make_shared<LayerAdvanceDataStoreMessage>(phase));
@@ -844,15 +880,119 @@ void HyPerCol::nonblockingLayerUpdate(
    }
 }
 
-Response::Status HyPerCol::respond(std::shared_ptr<BaseMessage const> message) {
-   if (auto castMessage = std::dynamic_pointer_cast<PrepareCheckpointWriteMessage const>(message)) {
-      return respondPrepareCheckpointWrite(castMessage);
+void HyPerCol::updateLayers(int phase) {
+   if (phase >= (int)mLayerUpdateSchedule.size()) {
+      return;
    }
-   else {
-      return Response::SUCCESS;
+   auto const &phaseSchedule = mLayerUpdateSchedule[phase];
+   int const numLayers       = (int)phaseSchedule.size();
+   Timer *phaseRecvTimer     = mPhaseRecvTimers.at(phase);
+
+   std::vector<bool> updated(numLayers, false);
+   std::vector<int> readyLayers;
+   std::vector<int> concurrentReady; // positions in readyLayers of the layers run concurrently
+   std::vector<Response::Status> readyStatus;
+   readyLayers.reserve(numLayers);
+   concurrentReady.reserve(numLayers);
+
+   int numUpdated       = 0;
+   long int idleCounter = 0;
+   while (numUpdated < numLayers) {
+      readyLayers.clear();
+      // A layer whose update makes MPI calls is not tested for ready input, since the test
+      // can come out differently on different processes. Instead, only the first such layer
+      // not yet updated is taken, once its dependencies have updated, and it waits for its
+      // input. Every process then makes the layers' MPI calls in the same order.
+      bool mpiLayerTaken = false;
+      for (int n = 0; n < numLayers; n++) {
+         if (updated[n]) {
+            continue;
+         }
+         LayerUpdateTask const &task = phaseSchedule[n];
+         bool const usesMPI          = !task.mLayer->updatesWithoutMPI();
+         if (usesMPI and mpiLayerTaken) {
+            continue;
+         }
+         bool predecessorsUpdated = true;
+         for (int p : task.mPredecessors) {
+            predecessorsUpdated &= updated[p];
+         }
+         if (usesMPI) {
+            mpiLayerTaken = true;
+            if (predecessorsUpdated) {
+               readyLayers.push_back(n);
+            }
+         }
+         else if (predecessorsUpdated and task.mLayer->isAllInputReady()) {
+            readyLayers.push_back(n);
+         }
+      }
+      int const numReady = (int)readyLayers.size();
+      if (numReady == 0) {
+         idleCounter++;
+         continue;
+      }
+
+      // Layers that make no MPI calls once their input has arrived can update on other threads.
+      // The rest update here on the main thread.
+      bool const concurrent = mConcurrentLayerUpdates and numReady > 1;
+      readyStatus.assign(numReady, Response::NO_ACTION);
+      concurrentReady.clear();
+      for (int r = 0; r < numReady; r++) {
+         HyPerLayer *layer = phaseSchedule[readyLayers[r]].mLayer;
+         layer->waitForAllInput();
+         if (concurrent and layer->updatesWithoutMPI()) {
+            concurrentReady.push_back(r);
+         }
+         else {
+            readyStatus[r] = layer->recvAndUpdateState(mSimTime, mDeltaTime, phaseRecvTimer);
+         }
+      }
+      int const numConcurrent = (int)concurrentReady.size();
+      if (numConcurrent > 0) {
+         // The layers all receive before any of them updates, so that the phase's receive timer
+         // measures only the receives, as it does for the layers updated on the main thread.
+         // None of these layers reads another, since each one's dependencies have updated.
+         phaseRecvTimer->start();
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(dynamic, 1)
+#endif // PV_USE_OPENMP_THREADS
+         for (int c = 0; c < numConcurrent; c++) {
+            HyPerLayer *layer = phaseSchedule[readyLayers[concurrentReady[c]]].mLayer;
+            layer->receiveInput(mSimTime, mDeltaTime, nullptr);
+         }
+         phaseRecvTimer->stop();
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(dynamic, 1)
+#endif // PV_USE_OPENMP_THREADS
+         for (int c = 0; c < numConcurrent; c++) {
+            int const r       = concurrentReady[c];
+            HyPerLayer *layer = phaseSchedule[readyLayers[r]].mLayer;
+            readyStatus[r]    = layer->updateStateFromInput(mSimTime, mDeltaTime);
+         }
+      }
+
+      for (int r = 0; r < numReady; r++) {
+         FatalIf(
+               readyStatus[r] == Response::POSTPONE,
+               "%s postponed updating its state.\n",
+               phaseSchedule[readyLayers[r]].mLayer->getDescription_c());
+         updated[readyLayers[r]] = true;
+      }
+      numUpdated += numReady;
+   }
+
+   if (idleCounter > 1L) {
+      InfoLog() << "t = " << mSimTime << ", phase " << phase << ", idle count " << idleCounter
+                << "\n";
    }
 }
 
+void HyPerCol::initMessageActionMap() {
+   Observer::initMessageActionMap();
+   setMessageAction(&HyPerCol::respondPrepareCheckpointWrite);
+}
+
 Response::Status HyPerCol::respondPrepareCheckpointWrite(
       std::shared_ptr<PrepareCheckpointWriteMessage const> message) {
    std::string path(message->mDirectory);
@@ -35,6 +35,7 @@
 
 namespace PV {
 
+class HyPerLayer;
 class PV_Init;
 class PVParams;
 
@@ -105,14 +106,23 @@ class HyPerCol : public Subject, public Observer {
     */
    virtual void ioParam_errorOnNotANumber(enum ParamsIOFlag ioFlag);
 
+   /**
+    * @brief concurrentLayerUpdates: If true, layers in the same phase whose input is ready
+    * receive and update concurrently, one layer per OpenMP thread. If false (the default),
+    * they receive and update one at a time, and each layer's kernels use all the threads.
+    * @details Layers that read each other directly (see HyPerLayer::getUpdateDependencies())
+    * are never updated concurrently. Nor are layers whose update makes MPI calls (see
+    * HyPerLayer::updatesWithoutMPI()); they are updated on the main thread. The option has no
+    * effect if PetaVision was built with PV_USE_CUDA.
+    */
+   virtual void ioParam_concurrentLayerUpdates(enum ParamsIOFlag ioFlag);
+
   public:
    HyPerCol(PV_Init *initObj);
    virtual ~HyPerCol();
 
    // Public functions
 
-   virtual Response::Status respond(std::shared_ptr<BaseMessage const> message) override;
-
    /**
     * Returns the object in the hierarchy with the given name, if any exists.
     * Returns the null pointer if the string does not match any object.
@@ -136,6 +146,16 @@ class HyPerCol : public Subject, public Observer {
    void nonblockingLayerUpdate(
          std::shared_ptr<LayerRecvSynapticInputMessage const> recvMessage,
          std::shared_ptr<LayerUpdateStateMessage const> updateMessage);
+
+   /**
+    * Receives and updates each layer in the given phase, using the schedule built by
+    * buildLayerUpdateSchedule(). Each pass over the schedule collects the layers whose input is
+    * ready and whose dependencies have updated, and then updates them, concurrently if
+    * concurrentLayerUpdates is set. Passes repeat until every layer in the phase has updated.
+    * Layers whose update makes MPI calls are updated on the main thread, one per pass, in
+    * schedule order, so that every process makes their MPI calls in the same order.
+    */
+   void updateLayers(int phase);
    int processParams(char const *path);
    int ioParamsFinishGroup(enum ParamsIOFlag);
    int ioParamsStartGroup(enum ParamsIOFlag ioFlag, const char *group_name);
@@ -198,6 +218,8 @@ class HyPerCol : public Subject, public Observer {
    }
 
   private:
+   virtual void initMessageActionMap() override;
+
    int getAutoGPUDevice();
 
 #ifdef PV_USE_CUDA
@@ -214,6 +236,13 @@ class HyPerCol : public Subject, public Observer {
    void ioParams(enum ParamsIOFlag ioFlag);
    int ioParamsFillGroup(enum ParamsIOFlag ioFlag);
    void addObject(BaseObject *obj);
+
+   /**
+    * Groups the layers in the hierarchy by phase, and, within each phase, records for each layer
+    * the layers it must not update before, namely the dependencies (in either direction) that
+    * come earlier in the hierarchy. Called once the CommunicateInitInfo stage is complete.
+    */
+   void buildLayerUpdateSchedule();
    int checkDirExists(const char *dirname, struct stat *pathstat);
    inline void notifyLoop(std::vector<std::shared_ptr<BaseMessage const>> messages) {
       bool printFlag = getCommunicator()->globalCommRank() == 0;
@@ -246,6 +275,7 @@ class HyPerCol : public Subject, public Observer {
    bool mErrorOnNotANumber; // If true, check each layer's activity buffer for
    // not-a-numbers and
    // exit with an error if any appear
+   bool mConcurrentLayerUpdates; // If true, update independent layers in a phase concurrently
    bool mCheckpointReadFlag; // whether to load from a checkpoint directory
    bool mReadyFlag; // Initially false; set to true when communicateInitInfo,
    // allocateDataStructures, and initializeState stages are completed
@@ -294,6 +324,14 @@ class HyPerCol : public Subject, public Observer {
    std::ofstream mTimeScaleStream;
    Timer *mRunTimer;
    std::vector<Timer *> mPhaseRecvTimers; // Timer ** mPhaseRecvTimers;
+
+   // An entry in the layer update schedule: a layer, and the positions in its phase's schedule
+   // of the layers that must update before it.
+   struct LayerUpdateTask {
+      HyPerLayer *mLayer;
+      std::vector<int> mPredecessors;
+   };
+   std::vector<std::vector<LayerUpdateTask>> mLayerUpdateSchedule; // indexed by phase
    unsigned int mRandomSeed;
 #ifdef PV_USE_CUDA
    PVCuda::CudaDevice *mCudaDevice; // object for running kernels on OpenCL device
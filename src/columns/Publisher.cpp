@@ -12,13 +12,22 @@
 
 namespace PV {
 
-Publisher::Publisher(MPIBlock const &mpiBlock, PVLayerCube *cube, int numLevels, bool isSparse) {
+Publisher::Publisher(
+      MPIBlock const &mpiBlock,
+      PVLayerCube *cube,
+      int numLevels,
+      bool isSparse,
+      bool shareCubeData) {
    this->mLayerCube = cube;
 
    int const numBuffers = cube->loc.nbatch;
    int const numItems   = cube->numItems / numBuffers; // number of items in one batch element.
 
-   store = new DataStore(numBuffers, numItems, numLevels, isSparse);
+   float *sharedBuffer = shareCubeData ? cube->data : nullptr;
+   // A sparse layer read with a delay keeps its older levels as active lists only.
+   bool const compactLevels = isSparse and numLevels > 1 and sharedBuffer == nullptr;
+   store                    = new DataStore(
+         numBuffers, numItems, numLevels, isSparse, sharedBuffer, compactLevels);
 
    mBorderExchanger = new BorderExchange(mpiBlock, cube->loc);
 
@@ -26,11 +35,14 @@ Publisher::Publisher(MPIBlock const &mpiBlock, PVLayerCube *cube, int numLevels,
    for (int l = 0; l < numLevels; l++) {
       auto *v = mpiRequestsBuffer->getBuffer(l, 0);
       v->clear();
-      v->reserve((NUM_NEIGHBORHOOD - 1) * numBuffers);
+      v->reserve(2 * (NUM_NEIGHBORHOOD - 1));
    }
 }
 
 Publisher::~Publisher() {
+   // The layer may already have freed the cube and the restricted active indices.
+   mRestrictedActiveIndices = nullptr;
+   mNumRestrictedActive     = nullptr;
    for (int l = 0; l < mpiRequestsBuffer->getNumLevels(); l++) {
       wait(l);
    }
@@ -62,19 +74,92 @@ PVLayerCube Publisher::createCube(int delay) {
    return store->createCube(mLayerCube->loc, delay);
 }
 
+PVLayerCube Publisher::createCubeWithoutWaiting(int delay) {
+   return store->createCube(mLayerCube->loc, delay);
+}
+
+SparseList<float>::Entry const *
+Publisher::createActiveList(int delay, int bufferId, long *numActive) {
+   pvAssert(store->isSparse());
+   wait(delay);
+   *numActive = *store->numActiveBuffer(bufferId, delay);
+   return store->activeList(bufferId, delay);
+}
+
 void Publisher::updateActiveIndices(int delay) {
    if (store->isSparse()) {
       for (int b = 0; b < store->getNumBuffers(); b++) {
          // Active indicies stored as local extended values
          if (*store->numActiveBuffer(b, delay) < 0L) {
-            store->updateActiveIndices(b, delay);
+            if (delay == 0 and mRestrictedActiveIndices != nullptr) {
+               mergeBorderActiveIndices(b);
+            }
+            else {
+               store->updateActiveIndices(b, delay);
+            }
          }
          pvAssert(*store->numActiveBuffer(b, delay) >= 0L);
       }
+      // Only clear the pending list if there is one, so that waiting on a publisher whose
+      // active indices are already up to date does not write to it.
+      if (delay == 0 and mRestrictedActiveIndices != nullptr) {
+         mRestrictedActiveIndices = nullptr;
+         mNumRestrictedActive     = nullptr;
+      }
+   }
+}
+
+void Publisher::mergeBorderActiveIndices(int b) {
+   PVLayerLoc const *loc = &mLayerCube->loc;
+   PVHalo const *halo    = &loc->halo;
+   int const nf          = loc->nf;
+   int const nxExt       = loc->nx + halo->lt + halo->rt;
+   int const nyExt       = loc->ny + halo->dn + halo->up;
+   int const rowStride   = nxExt * nf;
+
+   float const *activity                   = recvBuffer(b, 0);
+   SparseList<float>::Entry *activeIndices = recvActiveIndicesBuffer(b, 0);
+   int const numRestrictedItems            = loc->nx * loc->ny * nf;
+   auto const *restricted                  = &mRestrictedActiveIndices[b * numRestrictedItems];
+   long const numRestricted                = mNumRestrictedActive[b];
+   long numActive                          = 0L;
+
+   auto scan = [activity, activeIndices, &numActive](int start, int stop) {
+      for (int k = start; k < stop; k++) {
+         float const a = activity[k];
+         if (a != 0.0f) {
+            activeIndices[numActive].index = (uint32_t)k;
+            activeIndices[numActive].value = a;
+            numActive++;
+         }
+      }
+   };
+
+   // Rows above the restricted region, then, row by row, the left border, the restricted
+   // entries of that row, and the right border; then the rows below the restricted region.
+   // This keeps the entries in increasing order of index, as a full scan would.
+   scan(0, halo->up * rowStride);
+   long r = 0L;
+   for (int y = halo->up; y < halo->up + loc->ny; y++) {
+      int const rowStart      = y * rowStride;
+      int const interiorStart = rowStart + halo->lt * nf;
+      int const interiorStop  = interiorStart + loc->nx * nf;
+      scan(rowStart, interiorStart);
+      while (r < numRestricted and (int)restricted[r].index < interiorStop) {
+         activeIndices[numActive++] = restricted[r++];
+      }
+      scan(interiorStop, rowStart + rowStride);
    }
+   pvAssert(r == numRestricted);
+   scan((halo->up + loc->ny) * rowStride, nyExt * rowStride);
+
+   *recvNumActiveBuffer(b, 0) = numActive;
 }
 
-int Publisher::publish(double lastUpdateTime) {
+int Publisher::publish(
+      double lastUpdateTime,
+      SparseList<float>::Entry const *restrictedActiveIndices,
+      long const *numRestrictedActive) {
    //
    // Everyone publishes border region to neighbors even if no subscribers.
    // This means that everyone should wait as well.
@@ -85,13 +170,17 @@ int Publisher::publish(double lastUpdateTime) {
    float const *sendBuf = mLayerCube->data;
    float *recvBuf       = recvBuffer(0); // Grab all of the buffer, allocated continuously
 
-   memcpy(recvBuf, sendBuf, dataSize);
+   if (recvBuf != sendBuf) { // If the store shares the cube's buffer, there is nothing to copy.
+      memcpy(recvBuf, sendBuf, dataSize);
+   }
    exchangeBorders(&mLayerCube->loc, 0);
    store->setLastUpdateTime(0 /*bufferId*/, lastUpdateTime);
 
    for (int b = 0; b < store->getNumBuffers(); b++) {
       store->markActiveIndicesOutOfSync(b, 0);
    }
+   mRestrictedActiveIndices = restrictedActiveIndices;
+   mNumRestrictedActive     = numRestrictedActive;
    // Updating active indices is done after MPI wait in HyPerCol
    // to avoid race condition because exchangeBorders mpi is async
 
@@ -99,12 +188,33 @@ int Publisher::publish(double lastUpdateTime) {
 }
 
 void Publisher::copyForward(double lastUpdateTime) {
-   if (store->getNumLevels() > 1) {
+   mRestrictedActiveIndices = nullptr;
+   mNumRestrictedActive     = nullptr;
+   if (store->hasCompactLevels()) {
+      // The current level's buffer was not rotated, so it already holds the previous data,
+      // and newLevelIndex() copied the number of active values forward.
+      store->setLastUpdateTime(0 /*bufferId*/, lastUpdateTime);
+   }
+   else if (store->getNumLevels() > 1) {
       float *recvBuf  = recvBuffer(0); // Grab all of the buffer, allocated continuously
       size_t dataSize = mLayerCube->numItems * sizeof(float);
       memcpy(recvBuf, recvBuffer(0 /*bufferId*/, 1), dataSize);
       store->setLastUpdateTime(0 /*bufferId*/, lastUpdateTime);
-      updateActiveIndices(0); // alternately, could copy active indices forward as well.
+      if (store->isSparse()) {
+         // The data didn't change, so copy the active indices forward if they are in sync,
+         // rather than rescanning.
+         for (int b = 0; b < store->getNumBuffers(); b++) {
+            long const numActive = *recvNumActiveBuffer(b, 1);
+            if (numActive >= 0L) {
+               memcpy(
+                     recvActiveIndicesBuffer(b, 0),
+                     recvActiveIndicesBuffer(b, 1),
+                     (size_t)numActive * sizeof(SparseList<float>::Entry));
+            }
+            *recvNumActiveBuffer(b, 0) = numActive;
+         }
+         updateActiveIndices(0);
+      }
    }
 }
 
@@ -119,23 +229,9 @@ int Publisher::exchangeBorders(const PVLayerLoc *loc, int delay /*default 0*/) {
    auto *requestsVector = mpiRequestsBuffer->getBuffer(delay, 0);
    pvAssert(requestsVector->empty());
 
-   // Loop through batch.
-   // The loop over batch elements probably belongs inside
-   // BorderExchange::exchange(), but for this to happen, exchange() would need
-   // to know how its data argument is organized with respect to batching.
-   int exchangeVectorSize = 2 * (mBorderExchanger->getNumNeighbors() - 1);
-   for (int b = 0; b < loc->nbatch; b++) {
-      // don't send interior
-      pvAssert(requestsVector->size() == b * exchangeVectorSize);
-
-      float *data = recvBuffer(b, delay);
-      std::vector<MPI_Request> batchElementMPIRequest{};
-      mBorderExchanger->exchange(data, batchElementMPIRequest);
-      pvAssert(batchElementMPIRequest.size() == exchangeVectorSize);
-      requestsVector->insert(
-            requestsVector->end(), batchElementMPIRequest.begin(), batchElementMPIRequest.end());
-      pvAssert(requestsVector->size() == (b + 1) * exchangeVectorSize);
-   }
+   // One message to each neighbor covers all the batch elements.
+   mBorderExchanger->exchangeBatch(recvBuffer(0, delay), *requestsVector);
+   pvAssert(requestsVector->size() == 2 * (mBorderExchanger->getNumNeighbors() - 1));
 
 #endif // PV_USE_MPI
 
@@ -181,9 +277,18 @@ int Publisher::wait(int delay /*default 0*/) {
 }
 
 void Publisher::increaseTimeLevel() {
+   if (store->hasCompactLevels()) {
+      // The current level's active indices are kept when it becomes level 1, so they must be
+      // in sync; and its buffer will be published into again, so its exchange must be done.
+      wait(0);
+   }
    wait(mpiRequestsBuffer->getNumLevels() - 1);
    mpiRequestsBuffer->newLevel();
    store->newLevelIndex();
+   // Any restricted active indices not yet used belong to what is now level 1; level 1's
+   // active indices, if still out of sync, will be found by a full scan.
+   mRestrictedActiveIndices = nullptr;
+   mNumRestrictedActive     = nullptr;
 }
 
 } /* namespace PV */
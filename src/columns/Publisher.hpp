@@ -21,7 +21,22 @@ namespace PV {
 class Publisher {
 
   public:
-   Publisher(MPIBlock const &mpiBlock, PVLayerCube *cube, int numLevels, bool isSparse);
+   /**
+    * If shareCubeData is true, numLevels must be one, and the data store uses the cube's data
+    * buffer as its only level instead of allocating its own. Publishing then exchanges the
+    * border in place, without copying the data.
+    *
+    * If isSparse is true and numLevels is greater than one, the data store keeps only the
+    * current level as a dense buffer, and the older levels as lists of active indices
+    * (see DataStore). createCube() for a delay makes a dense copy of that level, once per
+    * timestep; createActiveList() reads the level's list without making one.
+    */
+   Publisher(
+         MPIBlock const &mpiBlock,
+         PVLayerCube *cube,
+         int numLevels,
+         bool isSparse,
+         bool shareCubeData = false);
    virtual ~Publisher();
 
    void
@@ -30,8 +45,18 @@ class Publisher {
    /**
     * Copies the data from the cube to the top level of the data store, and exchanges
     * the border.
+    *
+    * If the store is sparse, the layer can pass the active indices of the restricted region,
+    * in extended coordinates and increasing order: those of batch element b begin at
+    * restrictedActiveIndices[b * nx * ny * nf], and there are numRestrictedActive[b] of them.
+    * Once the border exchange completes, the store's active indices are then formed by merging
+    * that list with a scan of the border region only, instead of a scan of the whole extended
+    * buffer. The arrays must remain valid until the next call to increaseTimeLevel().
     */
-   int publish(double lastUpdateTime);
+   int publish(
+         double lastUpdateTime,
+         SparseList<float>::Entry const *restrictedActiveIndices = nullptr,
+         long const *numRestrictedActive                         = nullptr);
 
    /**
     * Keeps the data store in sync if the time advances but the data doesn't change.
@@ -49,14 +74,39 @@ class Publisher {
     */
    PVLayerCube createCube(int delay = 0);
 
+   /**
+    * creates a PVLayerCube pointing to the data in the data store at the given delay, without
+    * waiting for any pending border exchange. Only the restricted region of the data is then
+    * guaranteed to be current, and the active indices may be out of sync. Call wait(delay)
+    * before using the border region.
+    */
+   PVLayerCube createCubeWithoutWaiting(int delay = 0);
+
+   /**
+    * Returns the active indices of batch element bufferId at the given delay, in increasing
+    * order of extended index, and sets *numActive to their number. Like createCube(), this
+    * blocks until any pending border exchange for that delay level is completed. Unlike
+    * createCube(), it does not make a dense copy of an older level of a sparse store, so a
+    * reader that needs only the active indices reads each delay level as its list of events.
+    */
+   SparseList<float>::Entry const *createActiveList(int delay, int bufferId, long *numActive);
+
    int wait(int delay = 0);
 
+   bool isSharingCubeData() const { return store->isSharingBuffer(); }
+
    void increaseTimeLevel();
 
    void updateAllActiveIndices();
    void updateActiveIndices(int delay = 0);
 
   private:
+   /**
+    * Sets the top level's active indices for batch element b by merging the restricted active
+    * indices passed to publish() with the nonzero values of the border region.
+    */
+   void mergeBorderActiveIndices(int b);
+
    float *recvBuffer(int bufferId) { return store->buffer(bufferId); }
    float *recvBuffer(int bufferId, int delay) { return store->buffer(bufferId, delay); }
 
@@ -79,6 +129,11 @@ class Publisher {
    BorderExchange *mBorderExchanger = nullptr;
 
    RingBuffer<std::vector<MPI_Request>> *mpiRequestsBuffer = nullptr;
+
+   // The restricted active indices passed to the most recent publish(), until they are used
+   // or the time level advances.
+   SparseList<float>::Entry const *mRestrictedActiveIndices = nullptr;
+   long const *mNumRestrictedActive                         = nullptr;
    // std::vector<MPI_Request> requests;
    MPI_Datatype *neighborDatatypes;
 };
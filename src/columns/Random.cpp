@@ -8,6 +8,10 @@
 #include "Random.hpp"
 #include "columns/RandomSeed.hpp"
 #include "utils/PVLog.hpp"
+#include "utils/philox.hpp"
+
+#include <algorithm>
+#include <cstdint>
 
 namespace PV {
 
@@ -62,6 +66,7 @@ int Random::initializeFromLoc(const PVLayerLoc *locptr, bool isExtended) {
    int nbatchGlobal = locptr->nbatchGlobal;
    // Allocate buffer to store rngArraySize
    rngArray.resize(rngCount);
+   mSeeds.resize(rngCount);
    if (status == PV_SUCCESS) {
       int numTotalSeeds     = nxGlobalExt * nyGlobalExt * nf * nbatchGlobal;
       unsigned int seedBase = RandomSeed::instance()->allocate(numTotalSeeds);
@@ -81,6 +86,9 @@ int Random::initializeFromLoc(const PVLayerLoc *locptr, bool isExtended) {
                   (kb + locptr->kb0) * sbGlobal + (ky + locptr->ky0) * syGlobal + locptr->kx0;
             size_t count = nxExt * nf;
             cl_random_init(&(rngArray[localExtStart]), count, seedBase + globalExtStart);
+            for (size_t k = 0; k < count; k++) {
+               mSeeds[localExtStart + k] = seedBase + globalExtStart + (unsigned int)k;
+            }
          }
       }
    }
@@ -90,9 +98,13 @@ int Random::initializeFromLoc(const PVLayerLoc *locptr, bool isExtended) {
 int Random::initializeFromCount(int count) {
    int status = PV_SUCCESS;
    rngArray.resize(count);
+   mSeeds.resize(count);
    if (status == PV_SUCCESS) {
       unsigned int seedBase = RandomSeed::instance()->allocate(count);
       cl_random_init(rngArray.data(), (size_t)count, seedBase);
+      for (int k = 0; k < count; k++) {
+         mSeeds[k] = seedBase + (unsigned int)k;
+      }
    }
    return status;
 }
@@ -107,6 +119,52 @@ unsigned int Random::randomUInt(int localIndex) {
    return rngArray[localIndex].s0;
 }
 
+void Random::counterRandomUInt(
+      unsigned int *values,
+      int localIndex,
+      long step,
+      unsigned int substream,
+      unsigned int first,
+      int count) const {
+   // The key is the seed; the counter is the block number, the substream, and the two halves
+   // of the timestep. Each block holds four consecutive numbers of the stream.
+   std::uint32_t const key[2]       = {(std::uint32_t)mSeeds[localIndex], 0U};
+   std::uint64_t const unsignedStep = (std::uint64_t)step;
+   std::uint32_t const stepLow      = (std::uint32_t)unsignedStep;
+   std::uint32_t const stepHigh     = (std::uint32_t)(unsignedStep >> 32);
+   int const maxBlocks              = 64;
+   std::uint32_t blockValues[4 * maxBlocks];
+   int n = 0;
+   while (n < count) {
+      unsigned int const position = first + (unsigned int)n;
+      int const lane              = (int)(position % 4U);
+      int const numBlocks         = std::min((lane + count - n + 3) / 4, maxBlocks);
+      Philox4x32::generateBlocks(
+            position / 4U, substream, stepLow, stepHigh, key, numBlocks, blockValues);
+      int const numValues = std::min(4 * numBlocks - lane, count - n);
+      std::copy(&blockValues[lane], &blockValues[lane + numValues], &values[n]);
+      n += numValues;
+   }
+}
+
+void Random::counterUniformRandom(
+      float *values,
+      int localIndex,
+      long step,
+      unsigned int substream,
+      unsigned int first,
+      int count) const {
+   int const chunkSize = 256;
+   unsigned int integers[chunkSize];
+   for (int start = 0; start < count; start += chunkSize) {
+      int const n = std::min(count - start, chunkSize);
+      counterRandomUInt(integers, localIndex, step, substream, first + (unsigned int)start, n);
+      for (int k = 0; k < n; k++) {
+         values[start + k] = (float)integers[k] / (float)randomUIntMax();
+      }
+   }
+}
+
 Random::~Random() {}
 
 } /* namespace PV */
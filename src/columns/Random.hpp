@@ -53,6 +53,33 @@ class Random {
    }
    static inline unsigned int randomUIntMax() { return CL_RANDOM_MAX; }
 
+   /**
+    * Counter-based generation (see utils/philox.hpp). Fills values[0..count) with the numbers
+    * first, first + 1, ..., first + count - 1 of the stream belonging to the given local index,
+    * timestep and substream. The result depends only on the arguments and on the seed of the
+    * local index, which is determined by global index as for the Tausworthe generators. It does
+    * not depend on earlier calls, and it does not change or use the Tausworthe state; so streams
+    * can be generated in any order, from any thread, and in vectorized blocks.
+    */
+   void counterRandomUInt(
+         unsigned int *values,
+         int localIndex,
+         long step,
+         unsigned int substream,
+         unsigned int first,
+         int count) const;
+
+   /**
+    * Counter-based generation of numbers in [0, 1], scaled as uniformRandom() scales them.
+    */
+   void counterUniformRandom(
+         float *values,
+         int localIndex,
+         long step,
+         unsigned int substream,
+         unsigned int first,
+         int count) const;
+
   protected:
    Random();
    int initializeFromCount(int count);
@@ -64,6 +91,7 @@ class Random {
    // Member variables
   protected:
    std::vector<taus_uint4> rngArray;
+   std::vector<unsigned int> mSeeds; // The seed of each element of rngArray
 };
 
 } /* namespace PV */
@@ -117,23 +117,25 @@ void CheckpointEntryTimeScaleInfo::write(
       bool verifyWritesFlag) const {
    if (getMPIBlock()->getRank() == 0) {
       int batchWidth   = (int)mTimeScaleInfoPtr->mTimeScale.size();
-      std::string path = generatePath(checkpointDirectory, "bin");
-      FileStream fileStream{path.c_str(), std::ios_base::out, verifyWritesFlag};
+      std::string path       = generatePath(checkpointDirectory, "bin");
+      FileStream *fileStream = openOutputStream(path, verifyWritesFlag);
       for (int b = 0; b < batchWidth; b++) {
-         fileStream.write(&mTimeScaleInfoPtr->mTimeScale.at(b), sizeof(double));
-         fileStream.write(&mTimeScaleInfoPtr->mTimeScaleTrue.at(b), sizeof(double));
-         fileStream.write(&mTimeScaleInfoPtr->mTimeScaleMax.at(b), sizeof(double));
+         fileStream->write(&mTimeScaleInfoPtr->mTimeScale.at(b), sizeof(double));
+         fileStream->write(&mTimeScaleInfoPtr->mTimeScaleTrue.at(b), sizeof(double));
+         fileStream->write(&mTimeScaleInfoPtr->mTimeScaleMax.at(b), sizeof(double));
       }
-      path = generatePath(checkpointDirectory, "txt");
-      FileStream txtFileStream{path.c_str(), std::ios_base::out, verifyWritesFlag};
-      int kb0 = getMPIBlock()->getBatchIndex() * batchWidth;
+      delete fileStream;
+      path                      = generatePath(checkpointDirectory, "txt");
+      FileStream *txtFileStream = openOutputStream(path, verifyWritesFlag);
+      int kb0                   = getMPIBlock()->getBatchIndex() * batchWidth;
       for (std::size_t b = 0; b < batchWidth; b++) {
-         txtFileStream << "batch index = " << b + kb0 << "\n";
-         txtFileStream << "time = " << simTime << "\n";
-         txtFileStream << "timeScale = " << mTimeScaleInfoPtr->mTimeScale[b] << "\n";
-         txtFileStream << "timeScaleTrue = " << mTimeScaleInfoPtr->mTimeScaleTrue[b] << "\n";
-         txtFileStream << "timeScaleMax = " << mTimeScaleInfoPtr->mTimeScaleMax[b] << "\n";
+         *txtFileStream << "batch index = " << b + kb0 << "\n";
+         *txtFileStream << "time = " << simTime << "\n";
+         *txtFileStream << "timeScale = " << mTimeScaleInfoPtr->mTimeScale[b] << "\n";
+         *txtFileStream << "timeScaleTrue = " << mTimeScaleInfoPtr->mTimeScaleTrue[b] << "\n";
+         *txtFileStream << "timeScaleMax = " << mTimeScaleInfoPtr->mTimeScaleMax[b] << "\n";
       }
+      delete txtFileStream;
    }
 }
 
@@ -0,0 +1,91 @@
+/*
+ * InputPrefetcher.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "InputPrefetcher.hpp"
+#include "utils/PVAssert.hpp"
+
+namespace PV {
+
+InputPrefetcher::InputPrefetcher(int numThreads, std::function<Buffer<float>(int)> loader)
+      : mLoader(loader) {
+   pvAssert(numThreads > 0);
+   for (int t = 0; t < numThreads; t++) {
+      mThreads.emplace_back(&InputPrefetcher::run, this);
+   }
+}
+
+InputPrefetcher::~InputPrefetcher() {
+   {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mShuttingDown = true;
+   }
+   mCondition.notify_all();
+   for (auto &t : mThreads) {
+      t.join();
+   }
+}
+
+void InputPrefetcher::prefetch(std::vector<int> const &inputIndices) {
+   {
+      std::unique_lock<std::mutex> lock(mMutex);
+      waitForBatch(lock);
+      mIndices = inputIndices;
+      mBuffers.clear();
+      mBuffers.resize(inputIndices.size());
+      mNextToLoad = 0;
+      mNumLoaded  = 0;
+      mHaveBatch  = true;
+   }
+   mCondition.notify_all();
+}
+
+bool InputPrefetcher::collect(
+      std::vector<int> const &inputIndices,
+      std::vector<Buffer<float>> *output) {
+   std::unique_lock<std::mutex> lock(mMutex);
+   waitForBatch(lock);
+   bool match = mHaveBatch and mIndices == inputIndices;
+   if (match) {
+      output->resize(mBuffers.size());
+      for (std::size_t n = 0; n < mBuffers.size(); n++) {
+         output->at(n) = std::move(mBuffers[n]);
+      }
+   }
+   mIndices.clear();
+   mBuffers.clear();
+   mHaveBatch = false;
+   return match;
+}
+
+void InputPrefetcher::waitForBatch(std::unique_lock<std::mutex> &lock) {
+   mCondition.wait(lock, [this]() { return !mHaveBatch or mNumLoaded == (int)mIndices.size(); });
+}
+
+void InputPrefetcher::run() {
+   std::unique_lock<std::mutex> lock(mMutex);
+   while (true) {
+      mCondition.wait(lock, [this]() {
+         return (mHaveBatch and mNextToLoad < (int)mIndices.size()) or mShuttingDown;
+      });
+      if (mShuttingDown) {
+         break;
+      }
+      int const slot  = mNextToLoad++;
+      int const index = mIndices[slot];
+      lock.unlock();
+      Buffer<float> buffer = mLoader(index);
+      lock.lock();
+      // The batch cannot be replaced while this load is outstanding, since prefetch() and
+      // collect() both wait for every slot to be loaded.
+      mBuffers[slot] = std::move(buffer);
+      mNumLoaded++;
+      if (mNumLoaded == (int)mIndices.size()) {
+         mCondition.notify_all();
+      }
+   }
+}
+
+} // namespace PV
@@ -0,0 +1,74 @@
+/*
+ * InputPrefetcher.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef INPUTPREFETCHER_HPP_
+#define INPUTPREFETCHER_HPP_
+
+#include "structures/Buffer.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace PV {
+
+/**
+ * Owns a pool of threads that load the inputs for an InputLayer's next display period while
+ * the current one is being simulated. The layer calls prefetch() with the input indices that
+ * its BatchIndexer will use next; the threads call the loader function on each index, and
+ * collect() returns the results in the order the indices were given. At most one batch is in
+ * flight at a time, so the memory held is bounded by one display period's worth of inputs.
+ * The results do not depend on the number of threads or on the order in which they finish.
+ * The threads do not call MPI.
+ */
+class InputPrefetcher {
+  public:
+   /**
+    * The loader is called concurrently from the worker threads, and must be thread-safe.
+    */
+   InputPrefetcher(int numThreads, std::function<Buffer<float>(int)> loader);
+
+   /**
+    * Waits for any loads in progress to finish, and then stops the threads.
+    */
+   ~InputPrefetcher();
+
+   /**
+    * Starts loading the inputs with the given indices, and returns immediately.
+    * Any batch that was prefetched but not collected is discarded.
+    */
+   void prefetch(std::vector<int> const &inputIndices);
+
+   /**
+    * Blocks until the prefetched batch has been loaded. If its indices are the same as
+    * inputIndices, moves the loaded buffers into the output vector and returns true.
+    * Otherwise, or if nothing was prefetched, returns false and the caller should load the
+    * inputs itself. In either case, the prefetched batch is consumed.
+    */
+   bool collect(std::vector<int> const &inputIndices, std::vector<Buffer<float>> *output);
+
+  private:
+   void run();
+   void waitForBatch(std::unique_lock<std::mutex> &lock);
+
+  private:
+   std::function<Buffer<float>(int)> mLoader;
+   std::mutex mMutex;
+   std::condition_variable mCondition;
+   std::vector<int> mIndices;
+   std::vector<Buffer<float>> mBuffers;
+   int mNextToLoad    = 0;
+   int mNumLoaded     = 0;
+   bool mHaveBatch    = false;
+   bool mShuttingDown = false;
+   std::vector<std::thread> mThreads;
+};
+
+} // namespace PV
+
+#endif // INPUTPREFETCHER_HPP_
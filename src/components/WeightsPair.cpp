@@ -107,22 +107,10 @@ void WeightsPair::ioParam_initializeFromCheckpointFlag(enum ParamsIOFlag ioFlag)
          true /*warnIfAbsent*/);
 }
 
-Response::Status WeightsPair::respond(std::shared_ptr<BaseMessage const> message) {
-   Response::Status status = WeightsPairInterface::respond(message);
-   if (status != Response::SUCCESS) {
-      return status;
-   }
-   else if (
-         auto castMessage =
-               std::dynamic_pointer_cast<ConnectionFinalizeUpdateMessage const>(message)) {
-      return respondConnectionFinalizeUpdate(castMessage);
-   }
-   else if (auto castMessage = std::dynamic_pointer_cast<ConnectionOutputMessage const>(message)) {
-      return respondConnectionOutput(castMessage);
-   }
-   else {
-      return status;
-   }
+void WeightsPair::initMessageActionMap() {
+   WeightsPairInterface::initMessageActionMap();
+   setMessageAction(&WeightsPair::respondConnectionFinalizeUpdate);
+   setMessageAction(&WeightsPair::respondConnectionOutput);
 }
 
 Response::Status WeightsPair::respondConnectionFinalizeUpdate(
@@ -41,8 +41,6 @@ class WeightsPair : public WeightsPairInterface {
 
    virtual ~WeightsPair();
 
-   virtual Response::Status respond(std::shared_ptr<BaseMessage const> message) override;
-
    Weights *getPreWeights() { return mPreWeights; }
    Weights *getPostWeights() { return mPostWeights; }
 
@@ -53,6 +51,8 @@ class WeightsPair : public WeightsPairInterface {
    ArborList const *getArborList() const { return mArborList; }
 
   protected:
+   virtual void initMessageActionMap() override;
+
    WeightsPair() {}
 
    int initialize(char const *name, HyPerCol *hc);
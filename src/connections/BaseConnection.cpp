@@ -58,27 +58,11 @@ int BaseConnection::ioParamsFillGroup(enum ParamsIOFlag ioFlag) {
    return PV_SUCCESS;
 }
 
-Response::Status BaseConnection::respond(std::shared_ptr<BaseMessage const> message) {
-   Response::Status status = BaseObject::respond(message);
-   if (!Response::completed(status)) {
-      return status;
-   }
-   else if (
-         auto castMessage =
-               std::dynamic_pointer_cast<ConnectionWriteParamsMessage const>(message)) {
-      return respondConnectionWriteParams(castMessage);
-   }
-   else if (
-         auto castMessage =
-               std::dynamic_pointer_cast<ConnectionFinalizeUpdateMessage const>(message)) {
-      return respondConnectionFinalizeUpdate(castMessage);
-   }
-   else if (auto castMessage = std::dynamic_pointer_cast<ConnectionOutputMessage const>(message)) {
-      return respondConnectionOutput(castMessage);
-   }
-   else {
-      return status;
-   }
+void BaseConnection::initMessageActionMap() {
+   BaseObject::initMessageActionMap();
+   setMessageAction(&BaseConnection::respondConnectionWriteParams);
+   setMessageAction(&BaseConnection::respondConnectionFinalizeUpdate);
+   setMessageAction(&BaseConnection::respondConnectionOutput);
 }
 
 Response::Status BaseConnection::respondConnectionWriteParams(
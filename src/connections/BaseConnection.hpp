@@ -31,8 +31,6 @@ class BaseConnection : public BaseObject, public Subject {
    template <typename S>
    S *getComponentByType();
 
-   virtual Response::Status respond(std::shared_ptr<BaseMessage const> message) override;
-
    /**
     * The function that calls the DeliveryObject's deliver method
     */
@@ -54,6 +52,8 @@ class BaseConnection : public BaseObject, public Subject {
    bool getReceiveGpu() const { return mDeliveryObject->getReceiveGpu(); }
 
   protected:
+   virtual void initMessageActionMap() override;
+
    BaseConnection();
 
    int initialize(char const *name, HyPerCol *hc);
@@ -160,21 +160,11 @@ NormalizeBase *HyPerConn::createWeightNormalizer() {
 
 BaseWeightUpdater *HyPerConn::createWeightUpdater() { return new HebbianUpdater(name, parent); }
 
-Response::Status HyPerConn::respond(std::shared_ptr<BaseMessage const> message) {
-   Response::Status status = BaseConnection::respond(message);
-   if (!Response::completed(status)) {
-      return status;
-   }
-   else if (auto castMessage = std::dynamic_pointer_cast<ConnectionUpdateMessage const>(message)) {
-      return respondConnectionUpdate(castMessage);
-   }
-   else if (
-         auto castMessage = std::dynamic_pointer_cast<ConnectionNormalizeMessage const>(message)) {
-      return respondConnectionNormalize(castMessage);
-   }
-   else {
-      return status;
-   }
+void HyPerConn::initMessageActionMap() {
+   BaseConnection::initMessageActionMap();
+   setMessageAction(&HyPerConn::respondConnectionUpdate);
+   setMessageAction(&HyPerConn::respondConnectionNormalize);
+   setMessageAction(&HyPerConn::respondLayerPublish);
 }
 
 Response::Status
@@ -194,6 +184,14 @@ HyPerConn::respondConnectionNormalize(std::shared_ptr<ConnectionNormalizeMessage
          mComponentTable, message, parent->getCommunicator()->globalCommRank() == 0 /*printFlag*/);
 }
 
+Response::Status
+HyPerConn::respondLayerPublish(std::shared_ptr<LayerPublishMessage const> message) {
+   if (mWeightUpdater) {
+      mWeightUpdater->progressCommunication();
+   }
+   return Response::NO_ACTION;
+}
+
 Response::Status HyPerConn::initializeState() {
    return notify(
          mComponentTable,
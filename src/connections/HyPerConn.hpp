@@ -28,8 +28,6 @@ class HyPerConn : public BaseConnection {
 
    virtual ~HyPerConn();
 
-   virtual Response::Status respond(std::shared_ptr<BaseMessage const> message) override;
-
    // get-methods for params
    int getPatchSizeX() const { return mPatchSize->getPatchSizeX(); }
    int getPatchSizeY() const { return mPatchSize->getPatchSizeY(); }
@@ -71,6 +69,8 @@ class HyPerConn : public BaseConnection {
    }
 
   protected:
+   virtual void initMessageActionMap() override;
+
    HyPerConn();
 
    int initialize(char const *name, HyPerCol *hc);
@@ -91,6 +91,12 @@ class HyPerConn : public BaseConnection {
    Response::Status
    respondConnectionNormalize(std::shared_ptr<ConnectionNormalizeMessage const> message);
 
+   /**
+    * Lets the weight updater's nonblocking communication progress between the phases of the
+    * layer updates.
+    */
+   Response::Status respondLayerPublish(std::shared_ptr<LayerPublishMessage const> message);
+
    virtual Response::Status registerData(Checkpointer *checkpointer) override;
 
    virtual Response::Status initializeState() override;
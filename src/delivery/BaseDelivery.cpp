@@ -107,6 +107,10 @@ BaseDelivery::communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage con
    mPostLayer = mConnectionData->getPost();
    pvAssert(mPreLayer != nullptr and mPostLayer != nullptr);
 
+   // A layer with zeroCopyPublish exposes its activity as soon as it updates, so a layer in
+   // the same phase could see this timestep's activity instead of the previous one.
+   mPreLayer->checkZeroCopyReader(getDescription_c(), mPostLayer->getPhase());
+
    int numChannelsCheck = 0;
    int channelAsInt     = (int)getChannelCode();
    if (channelAsInt >= 0) {
@@ -42,6 +42,8 @@ class HyPerDelivery : public BaseDelivery {
   public:
    enum AccumulateType { UNDEFINED, CONVOLVE, STOCHASTIC };
 
+   enum DeliveryMode { STANDARD, TILED, SPARSE, GEMM };
+
    HyPerDelivery(char const *name, HyPerCol *hc);
 
    virtual ~HyPerDelivery();
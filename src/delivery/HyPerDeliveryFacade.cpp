@@ -17,6 +17,7 @@ HyPerDeliveryFacade::HyPerDeliveryFacade() {}
 
 HyPerDeliveryFacade::~HyPerDeliveryFacade() {
    delete mDeliveryIntern;
+   free(mDeliveryModeString);
 }
 
 int HyPerDeliveryFacade::initialize(char const *name, HyPerCol *hc) {
@@ -29,6 +30,7 @@ int HyPerDeliveryFacade::ioParamsFillGroup(enum ParamsIOFlag ioFlag) {
    int status = BaseDelivery::ioParamsFillGroup(ioFlag);
    ioParam_accumulateType(ioFlag);
    ioParam_updateGSynFromPostPerspective(ioFlag);
+   ioParam_deliveryMode(ioFlag);
    if (ioFlag == PARAMS_IO_READ) {
       createDeliveryIntern();
    }
@@ -83,6 +85,55 @@ void HyPerDeliveryFacade::ioParam_updateGSynFromPostPerspective(enum ParamsIOFla
          mUpdateGSynFromPostPerspective);
 }
 
+void HyPerDeliveryFacade::ioParam_deliveryMode(enum ParamsIOFlag ioFlag) {
+   pvAssert(!parent->parameters()->presentAndNotBeenRead(name, "receiveGpu"));
+   pvAssert(!parent->parameters()->presentAndNotBeenRead(name, "pvpatchAccumulateType"));
+   pvAssert(!parent->parameters()->presentAndNotBeenRead(name, "updateGSynFromPostPerspective"));
+   if (mReceiveGpu or mAccumulateType != HyPerDelivery::CONVOLVE) {
+      return;
+   }
+   parent->parameters()->ioParamString(
+         ioFlag, name, "deliveryMode", &mDeliveryModeString, "standard", false /*warnIfAbsent*/);
+   if (ioFlag == PARAMS_IO_READ) {
+      pvAssert(mDeliveryModeString and mDeliveryModeString[0]);
+      // Convert string to lowercase so that capitalization doesn't matter.
+      for (char *c = mDeliveryModeString; *c != '\0'; c++) {
+         *c = (char)tolower((int)*c);
+      }
+
+      if (strcmp(mDeliveryModeString, "standard") == 0) {
+         mDeliveryMode = HyPerDelivery::STANDARD;
+      }
+      else if (strcmp(mDeliveryModeString, "tiled") == 0 and !mUpdateGSynFromPostPerspective) {
+         mDeliveryMode = HyPerDelivery::TILED;
+      }
+      else if (strcmp(mDeliveryModeString, "sparse") == 0 and !mUpdateGSynFromPostPerspective) {
+         mDeliveryMode = HyPerDelivery::SPARSE;
+      }
+      else if (strcmp(mDeliveryModeString, "gemm") == 0 and mUpdateGSynFromPostPerspective) {
+         mDeliveryMode = HyPerDelivery::GEMM;
+      }
+      else {
+         if (parent->getCommunicator()->globalCommRank() == 0) {
+            ErrorLog().printf(
+                  "%s error: deliveryMode \"%s\" is unrecognized for %s perspective.\n",
+                  getDescription_c(),
+                  mDeliveryModeString,
+                  mUpdateGSynFromPostPerspective ? "postsynaptic" : "presynaptic");
+            if (mUpdateGSynFromPostPerspective) {
+               ErrorLog().printf("  Allowed values are \"standard\" or \"gemm\".\n");
+            }
+            else {
+               ErrorLog().printf(
+                     "  Allowed values are \"standard\", \"tiled\", or \"sparse\".\n");
+            }
+         }
+         MPI_Barrier(parent->getCommunicator()->globalCommunicator());
+         exit(EXIT_FAILURE);
+      }
+   }
+}
+
 void HyPerDeliveryFacade::createDeliveryIntern() {
    // Check channel number for noupdate
    if (getChannelCode() == CHANNEL_NOUPDATE) {
@@ -108,8 +159,22 @@ void HyPerDeliveryFacade::createDeliveryIntern() {
       switch (mAccumulateType) {
          case HyPerDelivery::CONVOLVE:
             if (getUpdateGSynFromPostPerspective()) {
+               if (getDeliveryMode() == HyPerDelivery::GEMM) {
+                  baseObject = Factory::instance()->createByKeyword(
+                        "PostsynapticPerspectiveGemmDelivery", name, parent);
+               }
+               else {
+                  baseObject = Factory::instance()->createByKeyword(
+                        "PostsynapticPerspectiveConvolveDelivery", name, parent);
+               }
+            }
+            else if (getDeliveryMode() == HyPerDelivery::TILED) {
+               baseObject = Factory::instance()->createByKeyword(
+                     "PresynapticPerspectiveTiledDelivery", name, parent);
+            }
+            else if (getDeliveryMode() == HyPerDelivery::SPARSE) {
                baseObject = Factory::instance()->createByKeyword(
-                     "PostsynapticPerspectiveConvolveDelivery", name, parent);
+                     "PresynapticPerspectiveSparseDelivery", name, parent);
             }
             else {
                baseObject = Factory::instance()->createByKeyword(
@@ -49,6 +49,28 @@ class HyPerDeliveryFacade : public BaseDelivery {
     * to manage potential collisions as multiple pre-neurons write to the same post-neuron.
     */
    virtual void ioParam_updateGSynFromPostPerspective(enum ParamsIOFlag ioFlag);
+
+   /**
+    * @brief deliveryMode: Specifies how the CPU convolution is organized.
+    * @details Possible choices are
+    * - standard: The default method for the chosen perspective.
+    * - tiled: (presynaptic perspective only) The presynaptic layer is divided into tiles
+    *   whose postsynaptic footprints do not overlap, and tiles are delivered in parallel waves
+    *   directly into GSyn. This avoids allocating, clearing, and reducing a post-layer-sized
+    *   buffer for each thread. Tiles inside the presynaptic restricted region are delivered
+    *   while the border exchange is still in flight.
+    * - sparse: (presynaptic perspective only) As tiled, but if the presynaptic layer is sparse,
+    *   its active neurons are first sorted by tile, so that the work is proportional to the
+    *   number of active neurons.
+    * - gemm: (postsynaptic perspective, sharedWeights true only) The receptive fields of
+    *   postsynaptic neurons sharing a kernel patch, over all batch elements, are packed into
+    *   a matrix, and GSyn is computed as a matrix product with the weights.
+    *
+    * Only read if pvpatchAccumulateType is convolve and receiveGpu is false.
+    * Like updateGSynFromPostPerspective, this parameter does not change the result of the
+    * convolution, except for round-off.
+    */
+   virtual void ioParam_deliveryMode(enum ParamsIOFlag ioFlag);
    /** @} */ // End of list of HyPerDeliveryFacade parameters.
 
   public:
@@ -68,6 +90,8 @@ class HyPerDeliveryFacade : public BaseDelivery {
 
    bool getConvertRateToSpikeCount() const { return mConvertRateToSpikeCount; }
 
+   HyPerDelivery::DeliveryMode getDeliveryMode() const { return mDeliveryMode; }
+
   protected:
    HyPerDeliveryFacade();
 
@@ -96,6 +120,9 @@ class HyPerDeliveryFacade : public BaseDelivery {
    char *mAccumulateTypeString         = nullptr;
    bool mUpdateGSynFromPostPerspective = false;
 
+   char *mDeliveryModeString                 = nullptr;
+   HyPerDelivery::DeliveryMode mDeliveryMode = HyPerDelivery::STANDARD;
+
    // Whether to check if pre-layer is spiking and, if it is not,
    // scale activity by dt to convert it to a spike count
    bool mConvertRateToSpikeCount = false;
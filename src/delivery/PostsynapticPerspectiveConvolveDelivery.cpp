@@ -7,6 +7,7 @@
 
 #include "PostsynapticPerspectiveConvolveDelivery.hpp"
 #include "columns/HyPerCol.hpp"
+#include "delivery/accumulate_kernels.hpp"
 
 namespace PV {
 
@@ -100,6 +101,8 @@ void PostsynapticPerspectiveConvolveDelivery::deliver() {
       int numPerStride      = postWeights->getPatchSizeX() * postWeights->getPatchSizeF();
       int neuronIndexStride = targetNf < 4 ? 1 : targetNf / 4;
 
+      AccumulateKernels const &kernels = getAccumulateKernels();
+
       for (int b = 0; b < nbatch; b++) {
          int sourceNxExt       = sourceNx + sourceHalo->rt + sourceHalo->lt;
          int sourceNyExt       = sourceNy + sourceHalo->dn + sourceHalo->up;
@@ -143,10 +146,7 @@ void PostsynapticPerspectiveConvolveDelivery::deliver() {
                   float *weightBuf    = postWeights->getDataFromPatchIndex(arbor, kTargetExt);
                   float *weightValues = weightBuf + ky * syp;
 
-                  float dv = 0.0f;
-                  for (int k = 0; k < numPerStride; ++k) {
-                     dv += a[k] * weightValues[k];
-                  }
+                  float dv = kernels.dot(numPerStride, a, weightValues);
                   *gSyn += mDeltaTimeFactor * dv;
                }
             }
@@ -0,0 +1,303 @@
+/*
+ * PostsynapticPerspectiveGemmDelivery.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "PostsynapticPerspectiveGemmDelivery.hpp"
+#include "columns/HyPerCol.hpp"
+#include "delivery/accumulate_kernels.hpp"
+#include <algorithm>
+
+#ifdef PV_USE_CBLAS
+#include <cblas.h>
+#endif // PV_USE_CBLAS
+
+namespace PV {
+
+int const PostsynapticPerspectiveGemmDelivery::gemmPanelWidth;
+
+PostsynapticPerspectiveGemmDelivery::PostsynapticPerspectiveGemmDelivery(
+      char const *name,
+      HyPerCol *hc) {
+   initialize(name, hc);
+}
+
+PostsynapticPerspectiveGemmDelivery::PostsynapticPerspectiveGemmDelivery() {}
+
+PostsynapticPerspectiveGemmDelivery::~PostsynapticPerspectiveGemmDelivery() {}
+
+int PostsynapticPerspectiveGemmDelivery::initialize(char const *name, HyPerCol *hc) {
+   return BaseObject::initialize(name, hc);
+}
+
+void PostsynapticPerspectiveGemmDelivery::setObjectType() {
+   mObjectType = "PostsynapticPerspectiveGemmDelivery";
+}
+
+int PostsynapticPerspectiveGemmDelivery::ioParamsFillGroup(enum ParamsIOFlag ioFlag) {
+   int status = HyPerDelivery::ioParamsFillGroup(ioFlag);
+   return status;
+}
+
+void PostsynapticPerspectiveGemmDelivery::ioParam_receiveGpu(enum ParamsIOFlag ioFlag) {
+   mReceiveGpu = false; // If it's true, we should be using a different class.
+}
+
+Response::Status PostsynapticPerspectiveGemmDelivery::communicateInitInfo(
+      std::shared_ptr<CommunicateInitInfoMessage const> message) {
+   auto status = HyPerDelivery::communicateInitInfo(message);
+   if (!Response::completed(status)) {
+      return status;
+   }
+   // HyPerDelivery::communicateInitInfo() postpones until mWeightsPair communicates.
+   pvAssert(mWeightsPair and mWeightsPair->getInitInfoCommunicatedFlag());
+   mWeightsPair->needPost();
+   FatalIf(
+         !mWeightsPair->getPostWeights()->getSharedFlag(),
+         "%s has deliveryMode \"gemm\", which requires sharedWeights to be true.\n",
+         getDescription_c());
+   return Response::SUCCESS;
+}
+
+Response::Status PostsynapticPerspectiveGemmDelivery::allocateDataStructures() {
+   auto status = HyPerDelivery::allocateDataStructures();
+   if (!Response::completed(status)) {
+      return status;
+   }
+   // The patch geometry, needed to locate the receptive fields, is set when the weights
+   // allocate their data structures.
+   if (!mWeightsPair->getDataStructuresAllocatedFlag()) {
+      return Response::POSTPONE;
+   }
+   allocatePanels();
+   return Response::SUCCESS;
+}
+
+void PostsynapticPerspectiveGemmDelivery::allocatePanels() {
+   PVLayerLoc const *postLoc = mPostLayer->getLayerLoc();
+   Weights *postWeights      = mWeightsPair->getPostWeights();
+
+   int const nxPost         = postLoc->nx;
+   int const nyPost         = postLoc->ny;
+   int const nfPost         = postLoc->nf;
+   PVHalo const *postHalo   = &postLoc->halo;
+   int const numDataPatches = postWeights->getNumDataPatches();
+
+   mKernelGroups.clear();
+   std::vector<int> groupIndex(numDataPatches, -1);
+   for (int k = 0; k < nxPost * nyPost; k++) {
+      int kExt = kIndexExtended(
+            k * nfPost,
+            nxPost,
+            nyPost,
+            nfPost,
+            postHalo->lt,
+            postHalo->rt,
+            postHalo->dn,
+            postHalo->up);
+      // With shared weights, feature f of the position uses data index dataIndex + f.
+      int dataIndex = postWeights->calcDataIndexFromPatchIndex(kExt);
+      pvAssert(dataIndex >= 0 and dataIndex < numDataPatches);
+      if (groupIndex[dataIndex] < 0) {
+         groupIndex[dataIndex] = (int)mKernelGroups.size();
+         mKernelGroups.emplace_back();
+         mKernelGroups.back().dataIndex = dataIndex;
+      }
+      KernelGroup &group = mKernelGroups[groupIndex[dataIndex]];
+      group.positions.push_back(k);
+      group.receptiveFieldStarts.push_back(postWeights->getGeometry()->getUnshrunkenStart(kExt));
+   }
+
+   int const nbatch = postLoc->nbatch;
+   mPanels.clear();
+   for (int g = 0; g < (int)mKernelGroups.size(); g++) {
+      int const numColumns = nbatch * (int)mKernelGroups[g].positions.size();
+      for (int start = 0; start < numColumns; start += gemmPanelWidth) {
+         Panel panel;
+         panel.groupIndex  = g;
+         panel.columnStart = start;
+         panel.numColumns  = std::min(gemmPanelWidth, numColumns - start);
+         mPanels.push_back(panel);
+      }
+   }
+
+   int const numThreads = parent->getNumThreads();
+   mThreadPackBuffers.resize(numThreads);
+   for (auto &buffer : mThreadPackBuffers) {
+      buffer.resize(postWeights->getPatchSizeOverall() * gemmPanelWidth);
+   }
+   mThreadProductBuffers.resize(numThreads);
+   for (auto &buffer : mThreadProductBuffers) {
+      buffer.resize(nfPost * gemmPanelWidth);
+   }
+}
+
+void PostsynapticPerspectiveGemmDelivery::packPanel(
+      Panel const &panel,
+      float const *activity,
+      float *packBuffer) {
+   PVLayerLoc const *preLoc = mPreLayer->getLayerLoc();
+   Weights *postWeights     = mWeightsPair->getPostWeights();
+
+   int const numPreExtended = mPreLayer->getNumExtended();
+   // source layer's extended y stride
+   int const sy = (preLoc->nx + preLoc->halo.lt + preLoc->halo.rt) * preLoc->nf;
+
+   int const yPatchSize   = postWeights->getPatchSizeY();
+   int const numPerStride = postWeights->getPatchSizeX() * postWeights->getPatchSizeF();
+
+   KernelGroup const &group = mKernelGroups[panel.groupIndex];
+   int const numPositions   = (int)group.positions.size();
+   for (int c = 0; c < panel.numColumns; c++) {
+      int const column  = panel.columnStart + c;
+      int const b       = column / numPositions;
+      int const p       = column % numPositions;
+      float const *a    = activity + b * numPreExtended + group.receptiveFieldStarts[p];
+      float *packColumn = packBuffer + c;
+      for (int ky = 0; ky < yPatchSize; ky++) {
+         float const *aRow = a + ky * sy;
+         float *packRow    = packColumn + ky * numPerStride * gemmPanelWidth;
+         for (int k = 0; k < numPerStride; k++) {
+            packRow[k * gemmPanelWidth] = aRow[k];
+         }
+      }
+   }
+}
+
+void PostsynapticPerspectiveGemmDelivery::multiplyPanel(
+      Panel const &panel,
+      int arbor,
+      float const *packBuffer,
+      float *product) {
+   Weights *postWeights = mWeightsPair->getPostWeights();
+
+   int const nfPost    = mPostLayer->getLayerLoc()->nf;
+   int const patchSize = postWeights->getPatchSizeOverall();
+
+   // The weights for features 0 through nfPost-1 are consecutive patches, so they form an
+   // nfPost-by-patchSize row-major matrix.
+   float const *weights =
+         postWeights->getDataFromDataIndex(arbor, mKernelGroups[panel.groupIndex].dataIndex);
+
+#ifdef PV_USE_CBLAS
+   cblas_sgemm(
+         CblasRowMajor,
+         CblasNoTrans,
+         CblasNoTrans,
+         nfPost,
+         panel.numColumns,
+         patchSize,
+         mDeltaTimeFactor,
+         weights,
+         patchSize,
+         packBuffer,
+         gemmPanelWidth,
+         0.0f,
+         product,
+         gemmPanelWidth);
+#else
+   std::fill(product, product + nfPost * gemmPanelWidth, 0.0f);
+   getAccumulateKernels().gemm(
+         nfPost,
+         panel.numColumns,
+         patchSize,
+         mDeltaTimeFactor,
+         weights,
+         patchSize,
+         packBuffer,
+         gemmPanelWidth,
+         product,
+         gemmPanelWidth);
+#endif // PV_USE_CBLAS
+}
+
+void PostsynapticPerspectiveGemmDelivery::deliver() {
+   // Check if we need to update based on connection's channel
+   if (getChannelCode() == CHANNEL_NOUPDATE) {
+      return;
+   }
+   float *postChannel = mPostLayer->getChannel(getChannelCode());
+   pvAssert(postChannel);
+
+   int const numPostRestricted = mPostLayer->getNumNeurons();
+   int const nfPost            = mPostLayer->getLayerLoc()->nf;
+   int const numPanels         = (int)mPanels.size();
+
+   int numAxonalArbors = mArborList->getNumAxonalArbors();
+   for (int arbor = 0; arbor < numAxonalArbors; arbor++) {
+      int delay                = mArborList->getDelay(arbor);
+      PVLayerCube activityCube = mPreLayer->getPublisher()->createCube(delay);
+
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (int panelIndex = 0; panelIndex < numPanels; panelIndex++) {
+#ifdef PV_USE_OPENMP_THREADS
+         int const thread = omp_get_thread_num();
+#else
+         int const thread = 0;
+#endif // PV_USE_OPENMP_THREADS
+         Panel const &panel = mPanels[panelIndex];
+         float *packBuffer  = mThreadPackBuffers[thread].data();
+         float *product     = mThreadProductBuffers[thread].data();
+
+         packPanel(panel, activityCube.data, packBuffer);
+         multiplyPanel(panel, arbor, packBuffer, product);
+
+         KernelGroup const &group = mKernelGroups[panel.groupIndex];
+         int const numPositions   = (int)group.positions.size();
+         for (int c = 0; c < panel.numColumns; c++) {
+            int const column = panel.columnStart + c;
+            int const b      = column / numPositions;
+            int const p      = column % numPositions;
+            float *gSyn      = postChannel + b * numPostRestricted + group.positions[p] * nfPost;
+            for (int f = 0; f < nfPost; f++) {
+               gSyn[f] += product[f * gemmPanelWidth + c];
+            }
+         }
+      }
+   }
+#ifdef PV_USE_CUDA
+   // CPU updated GSyn, now need to update GSyn on GPU
+   mPostLayer->setUpdatedDeviceGSynFlag(true);
+#endif // PV_USE_CUDA
+}
+
+void PostsynapticPerspectiveGemmDelivery::deliverUnitInput(float *recvBuffer) {
+   PVLayerLoc const *postLoc = mPostLayer->getLayerLoc();
+   Weights *postWeights      = mWeightsPair->getPostWeights();
+
+   int const numPostRestricted = mPostLayer->getNumNeurons();
+   int const nfPost            = postLoc->nf;
+   int const nbatch            = postLoc->nbatch;
+   int const patchSize         = postWeights->getPatchSizeOverall();
+   int const numGroups         = (int)mKernelGroups.size();
+
+   int numAxonalArbors = mArborList->getNumAxonalArbors();
+   for (int arbor = 0; arbor < numAxonalArbors; arbor++) {
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (int g = 0; g < numGroups; g++) {
+         KernelGroup const &group = mKernelGroups[g];
+         float const *weights     = postWeights->getDataFromDataIndex(arbor, group.dataIndex);
+         for (int f = 0; f < nfPost; f++) {
+            float const *w = weights + f * patchSize;
+            float dv       = 0.0f;
+            for (int k = 0; k < patchSize; k++) {
+               dv += w[k];
+            }
+            dv *= mDeltaTimeFactor;
+            for (int b = 0; b < nbatch; b++) {
+               float *recvBatch = recvBuffer + b * numPostRestricted;
+               for (int position : group.positions) {
+                  recvBatch[position * nfPost + f] += dv;
+               }
+            }
+         }
+      }
+   }
+}
+
+} // end namespace PV
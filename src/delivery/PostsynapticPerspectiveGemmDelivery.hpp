@@ -0,0 +1,127 @@
+/*
+ * PostsynapticPerspectiveGemmDelivery.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef POSTSYNAPTICPERSPECTIVEGEMMDELIVERY_HPP_
+#define POSTSYNAPTICPERSPECTIVEGEMMDELIVERY_HPP_
+
+#include "delivery/HyPerDelivery.hpp"
+
+namespace PV {
+
+/**
+ * The delivery class for shared-weight HyPerConns using the postsynaptic perspective on the CPU,
+ * with accumulate type "convolve" and deliveryMode "gemm".
+ *
+ * Postsynaptic neurons are grouped by which kernel patch they use. Within a group, the
+ * convolution is the product of an nfPost-by-patchSize weight matrix and a patchSize-by-N
+ * matrix whose columns are the receptive fields of the group's neurons, over all batch
+ * elements (im2col). The columns are packed into panels of at most gemmPanelWidth columns,
+ * and each panel is multiplied by the weights using a register-blocked SGEMM, or cblas_sgemm
+ * if PetaVision was built with PV_USE_CBLAS. The panels are distributed among the threads;
+ * since the panels write to disjoint postsynaptic neurons, no thread-private GSyn buffers
+ * are needed.
+ *
+ * Compared to PostsynapticPerspectiveConvolveDelivery, each weight is loaded once per panel
+ * instead of once per postsynaptic neuron, which pays off when nbatch or the number of
+ * neurons sharing a kernel is large.
+ */
+class PostsynapticPerspectiveGemmDelivery : public HyPerDelivery {
+  protected:
+   /**
+    * List of parameters needed from the PostsynapticPerspectiveGemmDelivery class
+    * @name PostsynapticPerspectiveGemmDelivery Parameters
+    * @{
+    */
+
+   /**
+    * @brief receiveGpu: PostsynapticPerspectiveGemmDelivery always sets receiveGpu to false.
+    */
+   virtual void ioParam_receiveGpu(enum ParamsIOFlag ioFlag) override;
+   /** @} */ // End of list of BaseDelivery parameters.
+
+  public:
+   PostsynapticPerspectiveGemmDelivery(char const *name, HyPerCol *hc);
+
+   virtual ~PostsynapticPerspectiveGemmDelivery();
+
+   /**
+    * The method that delivers presynaptic activity to the given postsynaptic channel.
+    * For each arbor, the panels are distributed among the threads. Each thread packs the
+    * receptive fields of its panel's columns, multiplies by the panel's weights, and adds
+    * the product into the post channel.
+    */
+   virtual void deliver() override;
+
+   virtual void deliverUnitInput(float *recvBuffer) override;
+
+   /** The maximum number of columns (batch element and postsynaptic position) in a panel. */
+   static int const gemmPanelWidth = 64;
+
+  protected:
+   /**
+    * The postsynaptic positions (restricted, with all features) that use the same kernel patch.
+    * positions[n] is the restricted index of the position divided by nfPost, and
+    * receptiveFieldStarts[n] is the extended presynaptic index of the upper-left corner of
+    * its receptive field.
+    */
+   struct KernelGroup {
+      int dataIndex;
+      std::vector<int> positions;
+      std::vector<long> receptiveFieldStarts;
+   };
+
+   /**
+    * A range of columns of one kernel group. Column n corresponds to batch element
+    * n / (number of positions in the group) and position n % (number of positions in the group).
+    */
+   struct Panel {
+      int groupIndex;
+      int columnStart;
+      int numColumns;
+   };
+
+   PostsynapticPerspectiveGemmDelivery();
+
+   int initialize(char const *name, HyPerCol *hc);
+
+   virtual void setObjectType() override;
+
+   virtual int ioParamsFillGroup(enum ParamsIOFlag ioFlag) override;
+
+   virtual Response::Status
+   communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage const> message) override;
+
+   virtual Response::Status allocateDataStructures() override;
+
+   /**
+    * Groups the postsynaptic positions by kernel patch, divides each group into panels,
+    * and allocates a packing buffer and a product buffer for each thread.
+    */
+   void allocatePanels();
+
+   /**
+    * Packs the receptive fields of the panel's columns into packBuffer, as a
+    * patchSize-by-numColumns matrix with row stride gemmPanelWidth.
+    */
+   void packPanel(Panel const &panel, float const *activity, float *packBuffer);
+
+   /**
+    * Sets product to the product of the panel's weights and the packed receptive fields,
+    * scaled by mDeltaTimeFactor.
+    */
+   void multiplyPanel(Panel const &panel, int arbor, float const *packBuffer, float *product);
+
+   // Data members
+  protected:
+   std::vector<KernelGroup> mKernelGroups;
+   std::vector<Panel> mPanels;
+   std::vector<std::vector<float>> mThreadPackBuffers;
+   std::vector<std::vector<float>> mThreadProductBuffers;
+}; // end class PostsynapticPerspectiveGemmDelivery
+
+} // end namespace PV
+
+#endif // POSTSYNAPTICPERSPECTIVEGEMMDELIVERY_HPP_
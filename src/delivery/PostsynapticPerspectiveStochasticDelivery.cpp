@@ -8,6 +8,9 @@
 #include "PostsynapticPerspectiveStochasticDelivery.hpp"
 #include "columns/HyPerCol.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 namespace PV {
 
 PostsynapticPerspectiveStochasticDelivery::PostsynapticPerspectiveStochasticDelivery(
@@ -60,6 +63,12 @@ Response::Status PostsynapticPerspectiveStochasticDelivery::allocateDataStructur
       return status;
    }
    mRandState = new Random(mPostLayer->getLayerLoc(), false /*restricted, not extended*/);
+   // Each thread generates the random numbers for one row of a patch at a time.
+   Weights *postWeights = mWeightsPair->getPostWeights();
+   mThreadRandomValues.resize(std::max(parent->getNumThreads(), 1));
+   for (auto &th : mThreadRandomValues) {
+      th.resize(postWeights->getPatchSizeX() * postWeights->getPatchSizeF());
+   }
    return Response::SUCCESS;
 }
 
@@ -71,6 +80,9 @@ void PostsynapticPerspectiveStochasticDelivery::deliver() {
    float *postChannel = mPostLayer->getChannel(getChannelCode());
    pvAssert(postChannel);
 
+   // The random numbers are drawn from counter-based streams, indexed by timestep.
+   long const step = std::lround(parent->simulationTime() / parent->getDeltaTime());
+
    int numAxonalArbors = mArborList->getNumAxonalArbors();
    for (int arbor = 0; arbor < numAxonalArbors; arbor++) {
       int delay                = mArborList->getDelay(arbor);
@@ -122,9 +134,13 @@ void PostsynapticPerspectiveStochasticDelivery::deliver() {
 #pragma omp parallel for schedule(static)
 #endif
             for (int feature = 0; feature < neuronIndexStride; feature++) {
+#ifdef PV_USE_OPENMP_THREADS
+               int const thread = omp_get_thread_num();
+#else
+               int const thread = 0;
+#endif // PV_USE_OPENMP_THREADS
                for (int idx = feature; idx < numPostRestricted; idx += neuronIndexStride) {
                   float *gSyn     = gSynPatchHeadBatch + idx;
-                  taus_uint4 *rng = mRandState->getRNG(idx);
 
                   int idxExtended = kIndexExtended(
                         idx,
@@ -150,10 +166,18 @@ void PostsynapticPerspectiveStochasticDelivery::deliver() {
                   float *weightBuf    = postWeights->getDataFromPatchIndex(arbor, kTargetExt);
                   float *weightValues = weightBuf + ky * syp;
 
+                  unsigned int *randomValues = mThreadRandomValues[thread].data();
+                  mRandState->counterRandomUInt(
+                        randomValues,
+                        b * numPostRestricted + idx,
+                        step,
+                        (unsigned int)arbor,
+                        (unsigned int)(ky * syp),
+                        numPerStride);
+
                   float dv = 0.0f;
                   for (int k = 0; k < numPerStride; ++k) {
-                     *rng     = cl_random_get(*rng);
-                     double p = (double)rng->s0 / cl_random_max(); // 0.0 < p < 1.0
+                     double p = (double)randomValues[k] / cl_random_max(); // 0.0 < p < 1.0
                      dv += (p < (double)(a[k] * mDeltaTimeFactor)) * weightValues[k];
                   }
                   *gSyn += dv;
@@ -188,6 +212,8 @@ void PostsynapticPerspectiveStochasticDelivery::deliverUnitInput(float *recvBuff
    int numPerStride      = postWeights->getPatchSizeX() * postWeights->getPatchSizeF();
    int neuronIndexStride = targetNf < 4 ? 1 : targetNf / 4;
 
+   long const step = std::lround(parent->simulationTime() / parent->getDeltaTime());
+
    int numAxonalArbors = mArborList->getNumAxonalArbors();
    for (int arbor = 0; arbor < numAxonalArbors; arbor++) {
       for (int b = 0; b < nbatch; b++) {
@@ -201,9 +227,13 @@ void PostsynapticPerspectiveStochasticDelivery::deliverUnitInput(float *recvBuff
 #pragma omp parallel for schedule(static)
 #endif
             for (int feature = 0; feature < neuronIndexStride; feature++) {
+#ifdef PV_USE_OPENMP_THREADS
+               int const thread = omp_get_thread_num();
+#else
+               int const thread = 0;
+#endif // PV_USE_OPENMP_THREADS
                for (int idx = feature; idx < numPostRestricted; idx += neuronIndexStride) {
                   float *recvLocation = recvBatch + idx;
-                  taus_uint4 *rng     = mRandState->getRNG(idx);
 
                   int kTargetExt = kIndexExtended(
                         idx,
@@ -217,10 +247,18 @@ void PostsynapticPerspectiveStochasticDelivery::deliverUnitInput(float *recvBuff
                   float *weightBuf    = postWeights->getDataFromPatchIndex(arbor, kTargetExt);
                   float *weightValues = weightBuf + ky * syp;
 
+                  unsigned int *randomValues = mThreadRandomValues[thread].data();
+                  mRandState->counterRandomUInt(
+                        randomValues,
+                        b * numPostRestricted + idx,
+                        step,
+                        (unsigned int)arbor,
+                        (unsigned int)(ky * syp),
+                        numPerStride);
+
                   float dv = 0.0f;
                   for (int k = 0; k < numPerStride; ++k) {
-                     *rng     = cl_random_get(*rng);
-                     double p = (double)rng->s0 / cl_random_max(); // 0.0 < p < 1.0
+                     double p = (double)randomValues[k] / cl_random_max(); // 0.0 < p < 1.0
                      dv += (p < (double)mDeltaTimeFactor) * weightValues[k];
                   }
                   *recvLocation += mDeltaTimeFactor * dv;
@@ -7,6 +7,7 @@
 
 #include "PresynapticPerspectiveConvolveDelivery.hpp"
 #include "columns/HyPerCol.hpp"
+#include "delivery/accumulate_kernels.hpp"
 
 namespace PV {
 
@@ -95,25 +96,43 @@ void PresynapticPerspectiveConvolveDelivery::deliver() {
    const int sy  = postLoc->nx * postLoc->nf; // stride in restricted layer
    const int syw = weights->getGeometry()->getPatchStrideY(); // stride in patch
 
-   bool const preLayerIsSparse = mPreLayer->getSparseFlag();
+   bool const preLayerIsSparse  = mPreLayer->getSparseFlag();
+   bool const preLayerIsSpiking = preLayerIsSparse and mPreLayer->activityIsSpiking();
+
+   AccumulateKernels const &kernels = getAccumulateKernels();
 
    int numAxonalArbors = mArborList->getNumAxonalArbors();
    for (int arbor = 0; arbor < numAxonalArbors; arbor++) {
-      int delay                = mArborList->getDelay(arbor);
-      PVLayerCube activityCube = mPreLayer->getPublisher()->createCube(delay);
+      int delay            = mArborList->getDelay(arbor);
+      Publisher *publisher = mPreLayer->getPublisher();
+      // The spike path reads only the delay level's list of active neurons, which the
+      // publisher keeps as is for every level of a sparse layer. Only the other paths need the
+      // dense cube, which for an older level is a copy made from that list.
+      PVLayerCube activityCube;
+      if (!preLayerIsSpiking) {
+         activityCube = publisher->createCube(delay);
+      }
 
       for (int b = 0; b < nbatch; b++) {
          size_t batchOffset                                 = b * numPreExtended;
-         float *activityBatch                               = activityCube.data + batchOffset;
+         float *activityBatch                               = nullptr;
          float *gSynPatchHeadBatch                          = postChannel + b * numPostRestricted;
          SparseList<float>::Entry const *activeIndicesBatch = NULL;
-         if (preLayerIsSparse) {
-            activeIndicesBatch =
-                  (SparseList<float>::Entry *)activityCube.activeIndices + batchOffset;
+         int numNeurons                                     = 0;
+         if (preLayerIsSpiking) {
+            long numSpikes     = 0L;
+            activeIndicesBatch = publisher->createActiveList(delay, b, &numSpikes);
+            numNeurons         = (int)numSpikes;
+         }
+         else {
+            activityBatch = activityCube.data + batchOffset;
+            if (preLayerIsSparse) {
+               activeIndicesBatch =
+                     (SparseList<float>::Entry *)activityCube.activeIndices + batchOffset;
+            }
+            numNeurons =
+                  preLayerIsSparse ? activityCube.numActive[b] : mPreLayer->getNumExtended();
          }
-
-         int numNeurons =
-               preLayerIsSparse ? activityCube.numActive[b] : mPreLayer->getNumExtended();
 
 #ifdef PV_USE_OPENMP_THREADS
          // Clear all thread gsyn buffer
@@ -167,10 +186,33 @@ void PresynapticPerspectiveConvolveDelivery::deliver() {
 
                   float *v                  = postPatchStart + y * sy;
                   float const *weightValues = weightDataStart + y * syw;
-                  for (int k = 0; k < nk; k++) {
-                     v[k] += a * weightValues[k];
-                  }
+                  kernels.axpy(nk, a, weightValues, v);
+               }
+            }
+         }
+         else if (preLayerIsSpiking) {
+            // Each active neuron has spiked, so its value is the same unit spike, and each
+            // spike adds its rows of weights to GSyn. The active list is scanned once, with
+            // the patch rows inside the loop over spikes.
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(guided)
+#endif
+            for (int idx = 0; idx < numNeurons; idx++) {
+               int kPreExt = activeIndicesBatch[idx].index;
+
+               // Activity
+               float const a = activeIndicesBatch[idx].value * mDeltaTimeFactor;
+
+               // gSyn
+               float *gSynPatchHead = gSynPatchHeadBatch;
+
+#ifdef PV_USE_OPENMP_THREADS
+               if (!mThreadGSyn.empty()) {
+                  gSynPatchHead = mThreadGSyn[omp_get_thread_num()].data();
                }
+#endif // PV_USE_OPENMP_THREADS
+
+               deliverSpike(arbor, kPreExt, a, sy, &gSynPatchHead[gSynPatchStart[kPreExt]]);
             }
          }
          else { // Sparse, use the stored activity / index pairs
@@ -213,9 +255,7 @@ void PresynapticPerspectiveConvolveDelivery::deliver() {
 
                   float *v                  = postPatchStart + y * sy;
                   float const *weightValues = weightDataStart + y * syw;
-                  for (int k = 0; k < nk; k++) {
-                     v[k] += a * weightValues[k];
-                  }
+                  kernels.axpy(nk, a, weightValues, v);
                }
             }
          }
@@ -243,6 +283,35 @@ void PresynapticPerspectiveConvolveDelivery::deliver() {
 #endif // PV_USE_CUDA
 }
 
+void PresynapticPerspectiveConvolveDelivery::deliverSpike(
+      int arbor,
+      int kPreExt,
+      float a,
+      int sy,
+      float *postPatchStart) {
+   if (a == 0.0f) {
+      return;
+   }
+   AccumulateKernels const &kernels = getAccumulateKernels();
+   Weights *weights                 = mWeightsPair->getPreWeights();
+   Patch const *patch               = &weights->getPatch(kPreExt);
+   int const syw                    = weights->getGeometry()->getPatchStrideY();
+   int const nk                     = patch->nx * weights->getPatchSizeF();
+   float const *weightDataHead      = weights->getDataFromPatchIndex(arbor, kPreExt);
+   float const *weightDataStart     = &weightDataHead[patch->offset];
+   // A value of one, the usual case, needs no multiplication.
+   if (a == 1.0f) {
+      for (int y = 0; y < patch->ny; y++) {
+         kernels.add(nk, weightDataStart + y * syw, postPatchStart + y * sy);
+      }
+   }
+   else {
+      for (int y = 0; y < patch->ny; y++) {
+         kernels.axpy(nk, a, weightDataStart + y * syw, postPatchStart + y * sy);
+      }
+   }
+}
+
 void PresynapticPerspectiveConvolveDelivery::deliverUnitInput(float *recvBuffer) {
    PVLayerLoc const *postLoc = mPostLayer->getLayerLoc();
    Weights *weights          = mWeightsPair->getPreWeights();
@@ -254,6 +323,8 @@ void PresynapticPerspectiveConvolveDelivery::deliverUnitInput(float *recvBuffer)
    const int sy  = postLoc->nx * postLoc->nf; // stride in restricted layer
    const int syw = weights->getGeometry()->getPatchStrideY(); // stride in patch
 
+   AccumulateKernels const &kernels = getAccumulateKernels();
+
    int numAxonalArbors = mArborList->getNumAxonalArbors();
    for (int arbor = 0; arbor < numAxonalArbors; arbor++) {
       for (int b = 0; b < nbatch; b++) {
@@ -306,9 +377,7 @@ void PresynapticPerspectiveConvolveDelivery::deliverUnitInput(float *recvBuffer)
 
                float *v                  = postPatchStart + y * sy;
                float const *weightValues = weightDataStart + y * syw;
-               for (int k = 0; k < nk; k++) {
-                  v[k] += mDeltaTimeFactor * weightValues[k];
-               }
+               kernels.axpy(nk, mDeltaTimeFactor, weightValues, v);
             }
          }
 #ifdef PV_USE_OPENMP_THREADS
@@ -46,6 +46,12 @@ class PresynapticPerspectiveConvolveDelivery : public HyPerDelivery {
     * possibility of collisions where more than one pre-neuron writes to the
     * same post-neuron, we internally allocate multiple buffers the size of the post channel,
     * and accumulate them at the end.
+    *
+    * If the presynaptic layer is sparse and spiking (activityIsSpiking() is true, as for LIF
+    * and for Retina with spikingFlag set), the active list is treated as a list of spike
+    * events: each spike adds its weights to the post channel, with no multiplication when
+    * its value times the delta-time factor is one. The active list is traversed once,
+    * instead of once per row of the patch as for other sparse layers.
     */
    virtual void deliver() override;
 
@@ -67,6 +73,12 @@ class PresynapticPerspectiveConvolveDelivery : public HyPerDelivery {
 
    void allocateThreadGSyn();
 
+   /**
+    * Adds a times the weights of the given presynaptic neuron and arbor to the post-channel
+    * region beginning at postPatchStart, whose rows are sy apart.
+    */
+   void deliverSpike(int arbor, int kPreExt, float a, int sy, float *postPatchStart);
+
    // Data members
   protected:
    std::vector<std::vector<float>> mThreadGSyn;
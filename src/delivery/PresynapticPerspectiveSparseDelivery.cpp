@@ -0,0 +1,207 @@
+/*
+ * PresynapticPerspectiveSparseDelivery.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "PresynapticPerspectiveSparseDelivery.hpp"
+#include "columns/HyPerCol.hpp"
+#include "delivery/accumulate_kernels.hpp"
+
+namespace PV {
+
+PresynapticPerspectiveSparseDelivery::PresynapticPerspectiveSparseDelivery(
+      char const *name,
+      HyPerCol *hc) {
+   initialize(name, hc);
+}
+
+PresynapticPerspectiveSparseDelivery::PresynapticPerspectiveSparseDelivery() {}
+
+PresynapticPerspectiveSparseDelivery::~PresynapticPerspectiveSparseDelivery() {}
+
+int PresynapticPerspectiveSparseDelivery::initialize(char const *name, HyPerCol *hc) {
+   return PresynapticPerspectiveTiledDelivery::initialize(name, hc);
+}
+
+void PresynapticPerspectiveSparseDelivery::setObjectType() {
+   mObjectType = "PresynapticPerspectiveSparseDelivery";
+}
+
+Response::Status PresynapticPerspectiveSparseDelivery::allocateDataStructures() {
+   auto status = PresynapticPerspectiveTiledDelivery::allocateDataStructures();
+   if (!Response::completed(status)) {
+      return status;
+   }
+   int const nbatch = mPreLayer->getLayerLoc()->nbatch;
+   mBucketStart.resize(nbatch * (mTiles.size() + 1));
+   return Response::SUCCESS;
+}
+
+void PresynapticPerspectiveSparseDelivery::sortActiveNeurons(
+      int b,
+      SparseList<float>::Entry const *activeIndices,
+      int numActive,
+      int sortedStart) {
+   int const nfPre    = mPreLayer->getLayerLoc()->nf;
+   int const numTiles = (int)mTiles.size();
+   int *bucketStart   = &mBucketStart[b * (numTiles + 1)];
+
+   // Counting sort: count the neurons in each tile, convert the counts to starting positions,
+   // and then place each neuron, advancing its tile's starting position as we go.
+   for (int t = 0; t <= numTiles; t++) {
+      bucketStart[t] = 0;
+   }
+   for (int idx = 0; idx < numActive; idx++) {
+      int tile = mPositionTiles[activeIndices[idx].index / nfPre];
+      if (tile >= 0 and activeIndices[idx].value != 0.0f) {
+         bucketStart[tile]++;
+      }
+   }
+   int position = sortedStart;
+   for (int t = 0; t <= numTiles; t++) {
+      int count      = bucketStart[t];
+      bucketStart[t] = position;
+      position += count;
+   }
+   for (int idx = 0; idx < numActive; idx++) {
+      int tile = mPositionTiles[activeIndices[idx].index / nfPre];
+      if (tile >= 0 and activeIndices[idx].value != 0.0f) {
+         mSortedIndices[bucketStart[tile]++] = activeIndices[idx];
+      }
+   }
+   // Each starting position has been advanced to the start of the next bucket; shift them back.
+   for (int t = numTiles; t > 0; t--) {
+      bucketStart[t] = bucketStart[t - 1];
+   }
+   bucketStart[0] = sortedStart;
+}
+
+void PresynapticPerspectiveSparseDelivery::deliverBucket(
+      int tileIndex,
+      int b,
+      int arbor,
+      float *gSyn) {
+   PVLayerLoc const *postLoc = mPostLayer->getLayerLoc();
+   Weights *weights          = mWeightsPair->getPreWeights();
+
+   const int sy  = postLoc->nx * postLoc->nf; // stride in restricted layer
+   const int syw = weights->getGeometry()->getPatchStrideY(); // stride in patch
+   const int nfp = weights->getPatchSizeF();
+
+   std::size_t const *gSynPatchStart = weights->getGeometry()->getGSynPatchStart().data();
+
+   AccumulateKernels const &kernels = getAccumulateKernels();
+
+   int const *bucketStart = &mBucketStart[b * (mTiles.size() + 1)];
+   for (int idx = bucketStart[tileIndex]; idx < bucketStart[tileIndex + 1]; idx++) {
+      int const kPreExt = mSortedIndices[idx].index;
+      float const a     = mSortedIndices[idx].value * mDeltaTimeFactor;
+
+      Patch const *patch = &weights->getPatch(kPreExt);
+
+      float *postPatchStart        = &gSyn[gSynPatchStart[kPreExt]];
+      const int nk                 = patch->nx * nfp;
+      float const *weightDataHead  = weights->getDataFromPatchIndex(arbor, kPreExt);
+      float const *weightDataStart = &weightDataHead[patch->offset];
+
+      for (int yp = 0; yp < patch->ny; yp++) {
+         float *v                  = postPatchStart + yp * sy;
+         float const *weightValues = weightDataStart + yp * syw;
+         kernels.axpy(nk, a, weightValues, v);
+      }
+   }
+}
+
+void PresynapticPerspectiveSparseDelivery::deliver() {
+   // Check if we need to update based on connection's channel
+   if (getChannelCode() == CHANNEL_NOUPDATE) {
+      return;
+   }
+   if (!mPreLayer->getSparseFlag()) {
+      PresynapticPerspectiveTiledDelivery::deliver();
+      return;
+   }
+   float *postChannel = mPostLayer->getChannel(getChannelCode());
+   pvAssert(postChannel);
+
+   PVLayerLoc const *preLoc  = mPreLayer->getLayerLoc();
+   PVLayerLoc const *postLoc = mPostLayer->getLayerLoc();
+
+   int const numPreExtended    = mPreLayer->getNumExtended();
+   int const numPostRestricted = postLoc->nx * postLoc->ny * postLoc->nf;
+
+   int nbatch = preLoc->nbatch;
+   pvAssert(nbatch == postLoc->nbatch);
+
+   int numAxonalArbors = mArborList->getNumAxonalArbors();
+   std::vector<int> sortedStart(nbatch);
+
+   // createCube() waits for the border exchange, so it must be called on the main thread,
+   // before the parallel region.
+   std::vector<PVLayerCube> activityCubes(numAxonalArbors);
+   for (int arbor = 0; arbor < numAxonalArbors; arbor++) {
+      int delay            = mArborList->getDelay(arbor);
+      activityCubes[arbor] = mPreLayer->getPublisher()->createCube(delay);
+   }
+
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel
+#endif
+   {
+      for (int arbor = 0; arbor < numAxonalArbors; arbor++) {
+         PVLayerCube const &activityCube = activityCubes[arbor];
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp single
+#endif
+         {
+            int total = 0;
+            for (int b = 0; b < nbatch; b++) {
+               sortedStart[b] = total;
+               total += (int)activityCube.numActive[b];
+            }
+            if ((int)mSortedIndices.size() < total) {
+               mSortedIndices.resize(total);
+            }
+         }
+
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp for schedule(static)
+#endif
+         for (int b = 0; b < nbatch; b++) {
+            auto const *activeIndices =
+                  (SparseList<float>::Entry const *)activityCube.activeIndices
+                  + b * numPreExtended;
+            sortActiveNeurons(b, activeIndices, (int)activityCube.numActive[b], sortedStart[b]);
+         }
+
+         for (auto const &colorTiles : mColorTiles) {
+            int const numTilesInColor = (int)colorTiles.size();
+            int const numTasks        = numTilesInColor * nbatch;
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp for schedule(dynamic)
+#endif
+            for (int task = 0; task < numTasks; task++) {
+               int b         = task / numTilesInColor;
+               int tileIndex = colorTiles[task % numTilesInColor];
+               deliverBucket(tileIndex, b, arbor, postChannel + b * numPostRestricted);
+            }
+         }
+      }
+   }
+#ifdef PV_USE_CUDA
+   // CPU updated GSyn, now need to update GSyn on GPU
+   mPostLayer->setUpdatedDeviceGSynFlag(true);
+#endif // PV_USE_CUDA
+}
+
+bool PresynapticPerspectiveSparseDelivery::isAllInputReady() {
+   if (mPreLayer->getSparseFlag()) {
+      return HyPerDelivery::isAllInputReady();
+   }
+   else {
+      return PresynapticPerspectiveTiledDelivery::isAllInputReady();
+   }
+}
+
+} // end namespace PV
@@ -0,0 +1,85 @@
+/*
+ * PresynapticPerspectiveSparseDelivery.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef PRESYNAPTICPERSPECTIVESPARSEDELIVERY_HPP_
+#define PRESYNAPTICPERSPECTIVESPARSEDELIVERY_HPP_
+
+#include "delivery/PresynapticPerspectiveTiledDelivery.hpp"
+#include "structures/SparseList.hpp"
+
+namespace PV {
+
+/**
+ * The delivery class for HyPerConns using the presynaptic perspective on the CPU,
+ * with accumulate type "convolve" and deliveryMode "sparse".
+ *
+ * The presynaptic layer is tiled and colored as in PresynapticPerspectiveTiledDelivery.
+ * Each timestep, the presynaptic layer's list of active neurons is sorted into one bucket per
+ * tile and batch element, and then each tile applies the whole patch of each of its active
+ * neurons. The work is therefore proportional to the number of active neurons times the patch
+ * size, and the sorting and the delivery take place in a single OpenMP parallel region.
+ *
+ * If the presynaptic layer is not sparse, there is no active list, and the delivery is the same
+ * as PresynapticPerspectiveTiledDelivery.
+ */
+class PresynapticPerspectiveSparseDelivery : public PresynapticPerspectiveTiledDelivery {
+  public:
+   PresynapticPerspectiveSparseDelivery(char const *name, HyPerCol *hc);
+
+   virtual ~PresynapticPerspectiveSparseDelivery();
+
+   /**
+    * The method that delivers presynaptic activity to the given postsynaptic channel.
+    * For each arbor, the active neurons of each batch element are sorted by tile, and then,
+    * for each color in turn, the buckets of that color are distributed among the threads.
+    */
+   virtual void deliver() override;
+
+   /**
+    * If the presynaptic layer is sparse, the active indices are needed, so this method waits
+    * for the border exchange as HyPerDelivery does. Otherwise, delivery is the same as
+    * PresynapticPerspectiveTiledDelivery, which does not need to wait.
+    */
+   virtual bool isAllInputReady() override;
+
+  protected:
+   PresynapticPerspectiveSparseDelivery();
+
+   int initialize(char const *name, HyPerCol *hc);
+
+   virtual void setObjectType() override;
+
+   virtual Response::Status allocateDataStructures() override;
+
+   /**
+    * Sorts the active neurons of batch element b into the buckets for that batch element,
+    * beginning at mSortedIndices[sortedStart]. Neurons with zero activity, or in tiles with no
+    * postsynaptic footprint, are dropped.
+    */
+   void sortActiveNeurons(
+         int b,
+         SparseList<float>::Entry const *activeIndices,
+         int numActive,
+         int sortedStart);
+
+   /**
+    * Applies the weights of each neuron in the bucket for the given tile and batch element.
+    */
+   void deliverBucket(int tileIndex, int b, int arbor, float *gSyn);
+
+   // Data members
+  protected:
+   // Active neurons, sorted by batch element and then by tile.
+   std::vector<SparseList<float>::Entry> mSortedIndices;
+
+   // The bucket for tile t and batch element b is the range of mSortedIndices from
+   // mBucketStart[b * (numTiles + 1) + t] to mBucketStart[b * (numTiles + 1) + t + 1].
+   std::vector<int> mBucketStart;
+}; // end class PresynapticPerspectiveSparseDelivery
+
+} // end namespace PV
+
+#endif // PRESYNAPTICPERSPECTIVESPARSEDELIVERY_HPP_
@@ -8,6 +8,9 @@
 #include "PresynapticPerspectiveStochasticDelivery.hpp"
 #include "columns/HyPerCol.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 // Note: there is a lot of code duplication between PresynapticPerspectiveConvolveDelivery
 // and PresynapticPerspectiveStochasticDelivery.
 
@@ -79,6 +82,12 @@ void PresynapticPerspectiveStochasticDelivery::allocateThreadGSyn() {
 
 void PresynapticPerspectiveStochasticDelivery::allocateRandState() {
    mRandState = new Random(mPreLayer->getLayerLoc(), true /*need RNGs in the extended buffer*/);
+   // Each thread generates the random numbers for one row of a patch at a time.
+   Weights *weights = mWeightsPair->getPreWeights();
+   mThreadRandomValues.resize(std::max(parent->getNumThreads(), 1));
+   for (auto &th : mThreadRandomValues) {
+      th.resize(weights->getPatchSizeX() * weights->getPatchSizeF());
+   }
 }
 
 void PresynapticPerspectiveStochasticDelivery::deliver() {
@@ -107,6 +116,9 @@ void PresynapticPerspectiveStochasticDelivery::deliver() {
 
    bool const preLayerIsSparse = mPreLayer->getSparseFlag();
 
+   // The random numbers are drawn from counter-based streams, indexed by timestep.
+   long const step = std::lround(parent->simulationTime() / parent->getDeltaTime());
+
    int numAxonalArbors = mArborList->getNumAxonalArbors();
    for (int arbor = 0; arbor < numAxonalArbors; arbor++) {
       int delay                = mArborList->getDelay(arbor);
@@ -145,6 +157,11 @@ void PresynapticPerspectiveStochasticDelivery::deliver() {
 #endif
                for (int idx = 0; idx < numNeurons; idx++) {
                   int kPreExt = idx;
+#ifdef PV_USE_OPENMP_THREADS
+                  int const thread = omp_get_thread_num();
+#else
+                  int const thread = 0;
+#endif // PV_USE_OPENMP_THREADS
 
                   // Weight
                   Patch const *patch = &weights->getPatch(kPreExt);
@@ -174,14 +191,23 @@ void PresynapticPerspectiveStochasticDelivery::deliver() {
                   const int nk                 = patch->nx * weights->getPatchSizeF();
                   float const *weightDataHead  = weights->getDataFromPatchIndex(arbor, kPreExt);
                   float const *weightDataStart = &weightDataHead[patch->offset];
-                  taus_uint4 *rng              = mRandState->getRNG(kPreExt);
                   long along                   = (long)((double)a * cl_random_max());
 
+                  // The stream of each presynaptic neuron is numbered by position in the
+                  // unshrunken patch, so that it does not depend on the MPI configuration.
+                  unsigned int *randomValues = mThreadRandomValues[thread].data();
+                  mRandState->counterRandomUInt(
+                        randomValues,
+                        (int)batchOffset + kPreExt,
+                        step,
+                        (unsigned int)arbor,
+                        (unsigned int)(patch->offset + y * syw),
+                        nk);
+
                   float *v                  = postPatchStart + y * sy;
                   float const *weightValues = weightDataStart + y * syw;
                   for (int k = 0; k < nk; k++) {
-                     *rng = cl_random_get(*rng);
-                     v[k] += (rng->s0 < along) * weightValues[k];
+                     v[k] += (randomValues[k] < along) * weightValues[k];
                   }
                }
             }
@@ -194,6 +220,11 @@ void PresynapticPerspectiveStochasticDelivery::deliver() {
 #endif
                for (int idx = 0; idx < numNeurons; idx++) {
                   int kPreExt = activeIndicesBatch[idx].index;
+#ifdef PV_USE_OPENMP_THREADS
+                  int const thread = omp_get_thread_num();
+#else
+                  int const thread = 0;
+#endif // PV_USE_OPENMP_THREADS
 
                   // Weight
                   Patch const *patch = &weights->getPatch(kPreExt);
@@ -223,14 +254,23 @@ void PresynapticPerspectiveStochasticDelivery::deliver() {
                   const int nk                 = patch->nx * weights->getPatchSizeF();
                   float const *weightDataHead  = weights->getDataFromPatchIndex(arbor, kPreExt);
                   float const *weightDataStart = &weightDataHead[patch->offset];
-                  taus_uint4 *rng              = mRandState->getRNG(kPreExt);
                   long along                   = (long)((double)a * cl_random_max());
 
+                  // The stream of each presynaptic neuron is numbered by position in the
+                  // unshrunken patch, so that it does not depend on the MPI configuration.
+                  unsigned int *randomValues = mThreadRandomValues[thread].data();
+                  mRandState->counterRandomUInt(
+                        randomValues,
+                        (int)batchOffset + kPreExt,
+                        step,
+                        (unsigned int)arbor,
+                        (unsigned int)(patch->offset + y * syw),
+                        nk);
+
                   float *v                  = postPatchStart + y * sy;
                   float const *weightValues = weightDataStart + y * syw;
                   for (int k = 0; k < nk; k++) {
-                     *rng = cl_random_get(*rng);
-                     v[k] += (rng->s0 < along) * weightValues[k];
+                     v[k] += (randomValues[k] < along) * weightValues[k];
                   }
                }
             }
@@ -266,8 +306,14 @@ void PresynapticPerspectiveStochasticDelivery::deliverUnitInput(float *recvBuffe
 
    int const numPostRestricted = postLoc->nx * postLoc->ny * postLoc->nf;
 
+   int const nxPreExtended  = preLoc->nx + preLoc->halo.lt + preLoc->halo.rt;
+   int const nyPreExtended  = preLoc->ny + preLoc->halo.dn + preLoc->halo.up;
+   int const numPreExtended = nxPreExtended * nyPreExtended * preLoc->nf;
+
    int nbatch = postLoc->nbatch;
 
+   long const step = std::lround(parent->simulationTime() / parent->getDeltaTime());
+
    const int sy  = postLoc->nx * postLoc->nf; // stride in restricted layer
    const int syw = weights->getGeometry()->getPatchStrideY(); // stride in patch
 
@@ -299,6 +345,11 @@ void PresynapticPerspectiveStochasticDelivery::deliverUnitInput(float *recvBuffe
 #endif
             for (int idx = 0; idx < numNeurons; idx++) {
                int kPreExt = idx;
+#ifdef PV_USE_OPENMP_THREADS
+               int const thread = omp_get_thread_num();
+#else
+               int const thread = 0;
+#endif // PV_USE_OPENMP_THREADS
 
                // Weight
                Patch const *patch = &weights->getPatch(kPreExt);
@@ -324,14 +375,21 @@ void PresynapticPerspectiveStochasticDelivery::deliverUnitInput(float *recvBuffe
                const int nk                 = patch->nx * weights->getPatchSizeF();
                float const *weightDataHead  = weights->getDataFromPatchIndex(arbor, kPreExt);
                float const *weightDataStart = &weightDataHead[patch->offset];
-               taus_uint4 *rng              = mRandState->getRNG(kPreExt);
                long along                   = (long)cl_random_max();
 
+               unsigned int *randomValues = mThreadRandomValues[thread].data();
+               mRandState->counterRandomUInt(
+                     randomValues,
+                     b * numPreExtended + kPreExt,
+                     step,
+                     (unsigned int)arbor,
+                     (unsigned int)(patch->offset + y * syw),
+                     nk);
+
                float *v                  = postPatchStart + y * sy;
                float const *weightValues = weightDataStart + y * syw;
                for (int k = 0; k < nk; k++) {
-                  *rng = cl_random_get(*rng);
-                  v[k] += (rng->s0 < along) * weightValues[k];
+                  v[k] += (randomValues[k] < along) * weightValues[k];
                }
             }
          }
@@ -49,6 +49,11 @@ class PresynapticPerspectiveStochasticDelivery : public HyPerDelivery {
     * possibility of collisions where more than one pre-neuron writes to the
     * same post-neuron, we internally allocate multiple buffers the size of the post channel,
     * and accumulate them at the end.
+    *
+    * The release of each synapse is decided by a counter-based random number (see
+    * Random::counterRandomUInt), indexed by neuron, timestep, arbor, and position in the patch.
+    * Each row of a patch gets its random numbers in one vectorized block, and the result does
+    * not depend on the number of threads or on the order in which the neurons are visited.
     */
    virtual void deliver() override;
 
@@ -73,6 +78,7 @@ class PresynapticPerspectiveStochasticDelivery : public HyPerDelivery {
   protected:
    std::vector<std::vector<float>> mThreadGSyn;
    Random *mRandState = nullptr;
+   std::vector<std::vector<unsigned int>> mThreadRandomValues;
 }; // end class PresynapticPerspectiveStochasticDelivery
 
 } // end namespace PV
@@ -0,0 +1,308 @@
+/*
+ * PresynapticPerspectiveTiledDelivery.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "PresynapticPerspectiveTiledDelivery.hpp"
+#include "columns/HyPerCol.hpp"
+#include "delivery/accumulate_kernels.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+namespace PV {
+
+PresynapticPerspectiveTiledDelivery::PresynapticPerspectiveTiledDelivery(
+      char const *name,
+      HyPerCol *hc) {
+   initialize(name, hc);
+}
+
+PresynapticPerspectiveTiledDelivery::PresynapticPerspectiveTiledDelivery() {}
+
+PresynapticPerspectiveTiledDelivery::~PresynapticPerspectiveTiledDelivery() {}
+
+int PresynapticPerspectiveTiledDelivery::initialize(char const *name, HyPerCol *hc) {
+   return BaseObject::initialize(name, hc);
+}
+
+void PresynapticPerspectiveTiledDelivery::setObjectType() {
+   mObjectType = "PresynapticPerspectiveTiledDelivery";
+}
+
+int PresynapticPerspectiveTiledDelivery::ioParamsFillGroup(enum ParamsIOFlag ioFlag) {
+   int status = HyPerDelivery::ioParamsFillGroup(ioFlag);
+   return status;
+}
+
+void PresynapticPerspectiveTiledDelivery::ioParam_receiveGpu(enum ParamsIOFlag ioFlag) {
+   mReceiveGpu = false; // If it's true, we should be using a different class.
+}
+
+Response::Status PresynapticPerspectiveTiledDelivery::communicateInitInfo(
+      std::shared_ptr<CommunicateInitInfoMessage const> message) {
+   auto status = HyPerDelivery::communicateInitInfo(message);
+   if (!Response::completed(status)) {
+      return status;
+   }
+   // HyPerDelivery::communicateInitInfo() postpones until mWeightsPair communicates.
+   pvAssert(mWeightsPair and mWeightsPair->getInitInfoCommunicatedFlag());
+   mWeightsPair->needPre();
+   return Response::SUCCESS;
+}
+
+Response::Status PresynapticPerspectiveTiledDelivery::allocateDataStructures() {
+   auto status = HyPerDelivery::allocateDataStructures();
+   if (!Response::completed(status)) {
+      return status;
+   }
+   allocateTiles();
+   return Response::SUCCESS;
+}
+
+// Returns the smallest period p >= 2 such that for any two indices i < j with j - i a multiple
+// of p, the intervals [lower[i], upper[i]) and [lower[j], upper[j]) do not overlap.
+// Empty intervals (lower >= upper) never overlap anything.
+static int computeColorPeriod(std::vector<int> const &lower, std::vector<int> const &upper) {
+   int const n = (int)lower.size();
+   for (int period = 2; period < n; period++) {
+      bool disjoint = true;
+      for (int i = 0; i < n and disjoint; i++) {
+         for (int j = i + period; j < n; j += period) {
+            bool emptyInterval = lower[i] >= upper[i] or lower[j] >= upper[j];
+            if (!emptyInterval and lower[j] < upper[i] and lower[i] < upper[j]) {
+               disjoint = false;
+               break;
+            }
+         }
+      }
+      if (disjoint) {
+         return period;
+      }
+   }
+   return std::max(n, 1);
+}
+
+void PresynapticPerspectiveTiledDelivery::allocateTiles() {
+   PVLayerLoc const *preLoc  = mPreLayer->getLayerLoc();
+   PVLayerLoc const *postLoc = mPostLayer->getLayerLoc();
+   Weights *weights          = mWeightsPair->getPreWeights();
+
+   int const nxPreExtended = preLoc->nx + preLoc->halo.lt + preLoc->halo.rt;
+   int const nyPreExtended = preLoc->ny + preLoc->halo.dn + preLoc->halo.up;
+
+   // Make each tile at least as wide as a patch, measured in postsynaptic neurons, so that
+   // typically only adjacent tiles overlap in the post layer, and four colors suffice.
+   double const xScale = (double)postLoc->nx / (double)preLoc->nx;
+   double const yScale = (double)postLoc->ny / (double)preLoc->ny;
+   int const tileSizeX = std::max((int)std::ceil(weights->getPatchSizeX() / xScale), 1);
+   int const tileSizeY = std::max((int)std::ceil(weights->getPatchSizeY() / yScale), 1);
+
+   // Shift the tile grid so that the restricted region begins on a tile boundary. Position x
+   // is then in tile column (x + offsetX) / tileSizeX, and similarly for y.
+   PVHalo const &halo = preLoc->halo;
+   int const offsetX  = (tileSizeX - halo.lt % tileSizeX) % tileSizeX;
+   int const offsetY  = (tileSizeY - halo.up % tileSizeY) % tileSizeY;
+
+   int const numTilesX = (nxPreExtended + offsetX + tileSizeX - 1) / tileSizeX;
+   int const numTilesY = (nyPreExtended + offsetY + tileSizeY - 1) / tileSizeY;
+
+   // Compute the footprint of each tile column and each tile row in the restricted post layer.
+   std::vector<int> columnLower(numTilesX, INT_MAX), columnUpper(numTilesX, INT_MIN);
+   std::vector<int> rowLower(numTilesY, INT_MAX), rowUpper(numTilesY, INT_MIN);
+   int const nfPre  = preLoc->nf;
+   int const sxPost = postLoc->nf;
+   int const syPost = postLoc->nx * postLoc->nf;
+   for (int y = 0; y < nyPreExtended; y++) {
+      for (int x = 0; x < nxPreExtended; x++) {
+         int kPreExt        = (y * nxPreExtended + x) * nfPre;
+         Patch const &patch = weights->getPatch(kPreExt);
+         if (patch.nx == 0 or patch.ny == 0) {
+            continue;
+         }
+         std::size_t start = weights->getGeometry()->getGSynPatchStart(kPreExt);
+         int xPost         = (int)((start % (std::size_t)syPost) / (std::size_t)sxPost);
+         int yPost         = (int)(start / (std::size_t)syPost);
+         int tx            = (x + offsetX) / tileSizeX;
+         int ty            = (y + offsetY) / tileSizeY;
+         columnLower[tx]   = std::min(columnLower[tx], xPost);
+         columnUpper[tx]   = std::max(columnUpper[tx], xPost + (int)patch.nx);
+         rowLower[ty]      = std::min(rowLower[ty], yPost);
+         rowUpper[ty]      = std::max(rowUpper[ty], yPost + (int)patch.ny);
+      }
+   }
+
+   // Two tiles whose column indices differ by a multiple of periodX have disjoint footprints
+   // in x; similarly for rows. Hence coloring by (tx % periodX, ty % periodY) guarantees
+   // that tiles of the same color never write to the same post neuron.
+   int const periodX   = computeColorPeriod(columnLower, columnUpper);
+   int const periodY   = computeColorPeriod(rowLower, rowUpper);
+   int const numColors = periodX * periodY;
+
+   mTiles.clear();
+   mColorTiles.clear();
+   mColorTiles.resize(numColors);
+   mPositionTiles.assign(nxPreExtended * nyPreExtended, -1);
+   for (int ty = 0; ty < numTilesY; ty++) {
+      if (rowLower[ty] >= rowUpper[ty]) {
+         continue;
+      }
+      for (int tx = 0; tx < numTilesX; tx++) {
+         if (columnLower[tx] >= columnUpper[tx]) {
+            continue;
+         }
+         Tile tile;
+         tile.xStart = std::max(tx * tileSizeX - offsetX, 0);
+         tile.xStop  = std::min((tx + 1) * tileSizeX - offsetX, nxPreExtended);
+         tile.yStart = std::max(ty * tileSizeY - offsetY, 0);
+         tile.yStop  = std::min((ty + 1) * tileSizeY - offsetY, nyPreExtended);
+         int color   = (ty % periodY) * periodX + (tx % periodX);
+         for (int y = tile.yStart; y < tile.yStop; y++) {
+            for (int x = tile.xStart; x < tile.xStop; x++) {
+               mPositionTiles[y * nxPreExtended + x] = (int)mTiles.size();
+            }
+         }
+         mColorTiles[color].push_back((int)mTiles.size());
+         mTiles.push_back(tile);
+      }
+   }
+
+   // Move the interior tiles of each color to the front of the color's list.
+   auto isInterior = [this, &halo, preLoc](int t) {
+      Tile const &tile = mTiles[t];
+      return tile.xStart >= halo.lt and tile.xStop <= halo.lt + preLoc->nx
+             and tile.yStart >= halo.up and tile.yStop <= halo.up + preLoc->ny;
+   };
+   mNumInteriorTiles.resize(numColors);
+   for (int c = 0; c < numColors; c++) {
+      auto &colorTiles = mColorTiles[c];
+      auto borderBegin = std::stable_partition(colorTiles.begin(), colorTiles.end(), isInterior);
+      mNumInteriorTiles[c] = (int)(borderBegin - colorTiles.begin());
+   }
+}
+
+void PresynapticPerspectiveTiledDelivery::deliverTile(
+      Tile const &tile,
+      int arbor,
+      float const *activity,
+      float *gSyn) {
+   PVLayerLoc const *preLoc  = mPreLayer->getLayerLoc();
+   PVLayerLoc const *postLoc = mPostLayer->getLayerLoc();
+   Weights *weights          = mWeightsPair->getPreWeights();
+
+   int const nxPreExtended = preLoc->nx + preLoc->halo.lt + preLoc->halo.rt;
+   int const nfPre         = preLoc->nf;
+
+   const int sy  = postLoc->nx * postLoc->nf; // stride in restricted layer
+   const int syw = weights->getGeometry()->getPatchStrideY(); // stride in patch
+   const int nfp = weights->getPatchSizeF();
+
+   std::size_t const *gSynPatchStart = weights->getGeometry()->getGSynPatchStart().data();
+
+   AccumulateKernels const &kernels = getAccumulateKernels();
+
+   for (int y = tile.yStart; y < tile.yStop; y++) {
+      int const kPreLineStart = (y * nxPreExtended + tile.xStart) * nfPre;
+      int const kPreLineStop  = (y * nxPreExtended + tile.xStop) * nfPre;
+      for (int kPreExt = kPreLineStart; kPreExt < kPreLineStop; kPreExt++) {
+         float a = mDeltaTimeFactor;
+         if (activity) {
+            a *= activity[kPreExt];
+            if (a == 0.0f) {
+               continue;
+            }
+         }
+
+         Patch const *patch = &weights->getPatch(kPreExt);
+
+         float *postPatchStart        = &gSyn[gSynPatchStart[kPreExt]];
+         const int nk                 = patch->nx * nfp;
+         float const *weightDataHead  = weights->getDataFromPatchIndex(arbor, kPreExt);
+         float const *weightDataStart = &weightDataHead[patch->offset];
+
+         for (int yp = 0; yp < patch->ny; yp++) {
+            float *v                  = postPatchStart + yp * sy;
+            float const *weightValues = weightDataStart + yp * syw;
+            kernels.axpy(nk, a, weightValues, v);
+         }
+      }
+   }
+}
+
+void PresynapticPerspectiveTiledDelivery::deliverTiles(
+      bool interior,
+      int arbor,
+      float const *activity,
+      float *postChannel) {
+   PVLayerLoc const *postLoc = mPostLayer->getLayerLoc();
+
+   int const numPreExtended    = mPreLayer->getNumExtended();
+   int const numPostRestricted = postLoc->nx * postLoc->ny * postLoc->nf;
+   int const nbatch            = postLoc->nbatch;
+
+   for (int c = 0; c < (int)mColorTiles.size(); c++) {
+      int const *tiles          = mColorTiles[c].data();
+      int const numTilesInColor = (int)mColorTiles[c].size();
+      int const start           = interior ? 0 : mNumInteriorTiles[c];
+      int const stop            = interior ? mNumInteriorTiles[c] : numTilesInColor;
+      int const numTiles        = stop - start;
+      int const numTasks        = numTiles * nbatch;
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (int task = 0; task < numTasks; task++) {
+         int b                      = task / numTiles;
+         Tile const &tile           = mTiles[tiles[start + task % numTiles]];
+         float const *batchActivity = activity ? activity + b * numPreExtended : nullptr;
+         float *gSyn                = postChannel + b * numPostRestricted;
+         deliverTile(tile, arbor, batchActivity, gSyn);
+      }
+   }
+}
+
+void PresynapticPerspectiveTiledDelivery::deliver() {
+   // Check if we need to update based on connection's channel
+   if (getChannelCode() == CHANNEL_NOUPDATE) {
+      return;
+   }
+   float *postChannel = mPostLayer->getChannel(getChannelCode());
+   pvAssert(postChannel);
+   pvAssert(mPreLayer->getLayerLoc()->nbatch == mPostLayer->getLayerLoc()->nbatch);
+
+   Publisher *publisher = mPreLayer->getPublisher();
+   int numAxonalArbors  = mArborList->getNumAxonalArbors();
+   for (int arbor = 0; arbor < numAxonalArbors; arbor++) {
+      int delay = mArborList->getDelay(arbor);
+
+      // The interior tiles only read the restricted region, which is current even while the
+      // border exchange is in flight.
+      PVLayerCube activityCube = publisher->createCubeWithoutWaiting(delay);
+      deliverTiles(true /*interior*/, arbor, activityCube.data, postChannel);
+
+      publisher->wait(delay);
+      deliverTiles(false /*border*/, arbor, activityCube.data, postChannel);
+   }
+#ifdef PV_USE_CUDA
+   // CPU updated GSyn, now need to update GSyn on GPU
+   mPostLayer->setUpdatedDeviceGSynFlag(true);
+#endif // PV_USE_CUDA
+}
+
+void PresynapticPerspectiveTiledDelivery::deliverUnitInput(float *recvBuffer) {
+   int numAxonalArbors = mArborList->getNumAxonalArbors();
+   for (int arbor = 0; arbor < numAxonalArbors; arbor++) {
+      deliverTiles(true /*interior*/, arbor, nullptr, recvBuffer);
+      deliverTiles(false /*border*/, arbor, nullptr, recvBuffer);
+   }
+}
+
+bool PresynapticPerspectiveTiledDelivery::isAllInputReady() {
+   // The active indices of a sparse layer are only valid once the exchange has finished.
+   if (mPreLayer->getSparseFlag()) {
+      return HyPerDelivery::isAllInputReady();
+   }
+   return true;
+}
+
+} // end namespace PV
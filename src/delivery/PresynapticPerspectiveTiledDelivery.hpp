@@ -0,0 +1,131 @@
+/*
+ * PresynapticPerspectiveTiledDelivery.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef PRESYNAPTICPERSPECTIVETILEDDELIVERY_HPP_
+#define PRESYNAPTICPERSPECTIVETILEDDELIVERY_HPP_
+
+#include "delivery/HyPerDelivery.hpp"
+
+namespace PV {
+
+/**
+ * The delivery class for HyPerConns using the presynaptic perspective on the CPU,
+ * with accumulate type "convolve" and deliveryMode "tiled".
+ *
+ * The presynaptic extended space is divided into rectangular tiles, and the tiles are
+ * assigned colors so that no two tiles of the same color have overlapping footprints in the
+ * postsynaptic layer. The tiles of each color are then processed as one parallel wave,
+ * with each thread writing directly into the post channel. This avoids the thread-private
+ * GSyn buffers, and their zeroing and reduction, used by
+ * PresynapticPerspectiveConvolveDelivery. Since each post neuron receives its input in an
+ * order that depends only on the tiling, the result does not depend on the number of threads.
+ *
+ * The tile grid is aligned with the presynaptic restricted region, so that most tiles lie
+ * entirely inside it. Since the restricted region is copied into the data store before the
+ * border exchange begins, these interior tiles are delivered while the exchange is in flight;
+ * only the tiles touching the border region wait for the exchange to finish. For the same
+ * reason, isAllInputReady() does not wait for the exchange unless the presynaptic layer is
+ * sparse.
+ */
+class PresynapticPerspectiveTiledDelivery : public HyPerDelivery {
+  protected:
+   /**
+    * List of parameters needed from the PresynapticPerspectiveTiledDelivery class
+    * @name PresynapticPerspectiveTiledDelivery Parameters
+    * @{
+    */
+
+   /**
+    * @brief receiveGpu: PresynapticPerspectiveTiledDelivery always sets receiveGpu to false.
+    */
+   virtual void ioParam_receiveGpu(enum ParamsIOFlag ioFlag) override;
+   /** @} */ // End of list of BaseDelivery parameters.
+
+  public:
+   PresynapticPerspectiveTiledDelivery(char const *name, HyPerCol *hc);
+
+   virtual ~PresynapticPerspectiveTiledDelivery();
+
+   /**
+    * The method that delivers presynaptic activity to the given postsynaptic channel.
+    * For each color in turn, the tiles of that color, over all batch elements, are
+    * distributed among the threads. Within a tile, presynaptic neurons with zero activity
+    * are skipped. The interior tiles of all colors are delivered first, and then, once the
+    * border exchange has finished, the border tiles.
+    */
+   virtual void deliver() override;
+
+   virtual void deliverUnitInput(float *recvBuffer) override;
+
+   /**
+    * Returns true if the presynaptic layer is not sparse: the interior tiles do not need the
+    * border exchange, and deliver() waits for it before delivering the border tiles. If the
+    * presynaptic layer is sparse, the base class's check is used instead.
+    */
+   virtual bool isAllInputReady() override;
+
+   /** Returns the number of colors (i.e. the number of parallel waves per arbor and batch) */
+   int getNumColors() const { return (int)mColorTiles.size(); }
+
+  protected:
+   /**
+    * A rectangle of presynaptic neurons, in extended coordinates. All features are included.
+    * The stop values are one past the last neuron in the tile.
+    */
+   struct Tile {
+      int xStart, xStop, yStart, yStop;
+   };
+
+   PresynapticPerspectiveTiledDelivery();
+
+   int initialize(char const *name, HyPerCol *hc);
+
+   virtual void setObjectType() override;
+
+   virtual int ioParamsFillGroup(enum ParamsIOFlag ioFlag) override;
+
+   virtual Response::Status
+   communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage const> message) override;
+
+   virtual Response::Status allocateDataStructures() override;
+
+   /**
+    * Divides the presynaptic extended space into tiles whose width is at least one postsynaptic
+    * patch, and groups the tiles by color, so that tiles of the same color never write
+    * to the same post neuron.
+    */
+   void allocateTiles();
+
+   /**
+    * Applies the weights of every presynaptic neuron in the given tile to the gSyn buffer.
+    * If activity is null, every presynaptic neuron is treated as having activity one.
+    */
+   void deliverTile(Tile const &tile, int arbor, float const *activity, float *gSyn);
+
+   /**
+    * For each color in turn, delivers either the interior tiles or the border tiles of that
+    * color, over all batch elements. If activity is null, every presynaptic neuron is treated
+    * as having activity one.
+    */
+   void deliverTiles(bool interior, int arbor, float const *activity, float *postChannel);
+
+   // Data members
+  protected:
+   std::vector<Tile> mTiles;
+   std::vector<std::vector<int>> mColorTiles; // mColorTiles[c] = indices of tiles of color c
+
+   // The tiles of color c that lie in the restricted region come first in mColorTiles[c];
+   // there are mNumInteriorTiles[c] of them.
+   std::vector<int> mNumInteriorTiles;
+
+   // The index into mTiles of the tile containing each presynaptic extended position
+   // (y * nxExtended + x), or -1 if that tile was dropped for having no postsynaptic footprint.
+   std::vector<int> mPositionTiles;
+}; // end class PresynapticPerspectiveTiledDelivery
+
+} // end namespace PV
+
+#endif // PRESYNAPTICPERSPECTIVETILEDDELIVERY_HPP_
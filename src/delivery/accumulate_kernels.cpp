@@ -0,0 +1,453 @@
+/*
+ * accumulate_kernels.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "delivery/accumulate_kernels.hpp"
+#include <algorithm>
+
+// The vectorized variants are compiled with per-function target attributes, so that the library
+// as a whole does not require AVX2 or AVX-512. Which variant is used is decided at run time.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define PV_ACCUMULATE_KERNELS_X86
+#include <immintrin.h>
+#endif // defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define PV_ACCUMULATE_KERNELS_NEON
+#include <arm_neon.h>
+#endif // defined(__aarch64__) && defined(__ARM_NEON)
+
+namespace PV {
+
+static void accumulateAxpyScalar(int nk, float a, float const *RESTRICT w, float *RESTRICT v) {
+   for (int k = 0; k < nk; k++) {
+      v[k] += a * w[k];
+   }
+}
+
+static void accumulateAddScalar(int nk, float const *RESTRICT w, float *RESTRICT v) {
+   for (int k = 0; k < nk; k++) {
+      v[k] += w[k];
+   }
+}
+
+static float accumulateDotScalar(int nk, float const *RESTRICT a, float const *RESTRICT w) {
+   float dv = 0.0f;
+   for (int k = 0; k < nk; k++) {
+      dv += a[k] * w[k];
+   }
+   return dv;
+}
+
+// Number of rows of B processed before moving on to the next block of columns of C. A block of
+// gemmBlockK rows of a register-width slice of B stays in the L1 cache.
+int const gemmBlockK = 256;
+
+// GEMM in terms of the axpy kernel: each row of C is updated by k axpy's of rows of B.
+// The vectorized variants use this for the rows and columns left over by their register blocks.
+static inline void accumulateGemmByAxpy(
+      AccumulateAxpyFunction axpy,
+      int m,
+      int n,
+      int k,
+      float alpha,
+      float const *RESTRICT a,
+      int lda,
+      float const *RESTRICT b,
+      int ldb,
+      float *RESTRICT c,
+      int ldc) {
+   if (n <= 0) {
+      return;
+   }
+   for (int i = 0; i < m; i++) {
+      for (int kk = 0; kk < k; kk++) {
+         axpy(n, alpha * a[i * lda + kk], &b[kk * ldb], &c[i * ldc]);
+      }
+   }
+}
+
+static void accumulateGemmScalar(
+      int m,
+      int n,
+      int k,
+      float alpha,
+      float const *RESTRICT a,
+      int lda,
+      float const *RESTRICT b,
+      int ldb,
+      float *RESTRICT c,
+      int ldc) {
+   accumulateGemmByAxpy(accumulateAxpyScalar, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+}
+
+#ifdef PV_ACCUMULATE_KERNELS_X86
+__attribute__((target("avx2,fma"))) static void
+accumulateAxpyAVX2(int nk, float a, float const *RESTRICT w, float *RESTRICT v) {
+   __m256 const va = _mm256_set1_ps(a);
+   int k           = 0;
+   for (; k + 8 <= nk; k += 8) {
+      __m256 vv = _mm256_loadu_ps(&v[k]);
+      vv        = _mm256_fmadd_ps(va, _mm256_loadu_ps(&w[k]), vv);
+      _mm256_storeu_ps(&v[k], vv);
+   }
+   for (; k < nk; k++) {
+      v[k] += a * w[k];
+   }
+}
+
+__attribute__((target("avx2,fma"))) static void
+accumulateAddAVX2(int nk, float const *RESTRICT w, float *RESTRICT v) {
+   int k = 0;
+   for (; k + 8 <= nk; k += 8) {
+      _mm256_storeu_ps(&v[k], _mm256_add_ps(_mm256_loadu_ps(&v[k]), _mm256_loadu_ps(&w[k])));
+   }
+   for (; k < nk; k++) {
+      v[k] += w[k];
+   }
+}
+
+__attribute__((target("avx2,fma"))) static float
+accumulateDotAVX2(int nk, float const *RESTRICT a, float const *RESTRICT w) {
+   __m256 sum0 = _mm256_setzero_ps();
+   __m256 sum1 = _mm256_setzero_ps();
+   int k       = 0;
+   for (; k + 16 <= nk; k += 16) {
+      sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(&a[k]), _mm256_loadu_ps(&w[k]), sum0);
+      sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(&a[k + 8]), _mm256_loadu_ps(&w[k + 8]), sum1);
+   }
+   if (k + 8 <= nk) {
+      sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(&a[k]), _mm256_loadu_ps(&w[k]), sum0);
+      k += 8;
+   }
+   __m256 sum  = _mm256_add_ps(sum0, sum1);
+   __m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+   sum4        = _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4));
+   sum4        = _mm_add_ss(sum4, _mm_shuffle_ps(sum4, sum4, 0x1));
+   float dv    = _mm_cvtss_f32(sum4);
+   for (; k < nk; k++) {
+      dv += a[k] * w[k];
+   }
+   return dv;
+}
+
+// The AVX2 micro-kernel holds a 4-by-16 block of C in eight registers, and updates it with one
+// row of A and B at a time.
+__attribute__((target("avx2,fma"))) static void accumulateGemmAVX2(
+      int m,
+      int n,
+      int k,
+      float alpha,
+      float const *RESTRICT a,
+      int lda,
+      float const *RESTRICT b,
+      int ldb,
+      float *RESTRICT c,
+      int ldc) {
+   int const blockM    = 4;
+   int const blockN    = 16;
+   int const mBlocked  = m - m % blockM;
+   int const nBlocked  = n - n % blockN;
+   __m256 const vAlpha = _mm256_set1_ps(alpha);
+   for (int k0 = 0; k0 < k; k0 += gemmBlockK) {
+      int const kc = std::min(gemmBlockK, k - k0);
+      for (int i = 0; i < mBlocked; i += blockM) {
+         float const *aBlock = &a[i * lda + k0];
+         for (int j = 0; j < nBlocked; j += blockN) {
+            __m256 sum[blockM][2];
+            for (int r = 0; r < blockM; r++) {
+               sum[r][0] = _mm256_setzero_ps();
+               sum[r][1] = _mm256_setzero_ps();
+            }
+            float const *bRow = &b[k0 * ldb + j];
+            for (int kk = 0; kk < kc; kk++, bRow += ldb) {
+               __m256 const b0 = _mm256_loadu_ps(bRow);
+               __m256 const b1 = _mm256_loadu_ps(bRow + 8);
+               for (int r = 0; r < blockM; r++) {
+                  __m256 const ar = _mm256_broadcast_ss(&aBlock[r * lda + kk]);
+                  sum[r][0]       = _mm256_fmadd_ps(ar, b0, sum[r][0]);
+                  sum[r][1]       = _mm256_fmadd_ps(ar, b1, sum[r][1]);
+               }
+            }
+            for (int r = 0; r < blockM; r++) {
+               float *cRow = &c[(i + r) * ldc + j];
+               _mm256_storeu_ps(cRow, _mm256_fmadd_ps(vAlpha, sum[r][0], _mm256_loadu_ps(cRow)));
+               _mm256_storeu_ps(
+                     cRow + 8, _mm256_fmadd_ps(vAlpha, sum[r][1], _mm256_loadu_ps(cRow + 8)));
+            }
+         }
+      }
+   }
+   // The columns to the right of the blocked region, and then the rows below it.
+   accumulateGemmByAxpy(
+         accumulateAxpyAVX2,
+         mBlocked,
+         n - nBlocked,
+         k,
+         alpha,
+         a,
+         lda,
+         &b[nBlocked],
+         ldb,
+         &c[nBlocked],
+         ldc);
+   accumulateGemmByAxpy(
+         accumulateAxpyAVX2,
+         m - mBlocked,
+         n,
+         k,
+         alpha,
+         &a[mBlocked * lda],
+         lda,
+         b,
+         ldb,
+         &c[mBlocked * ldc],
+         ldc);
+}
+
+__attribute__((target("avx512f"))) static void
+accumulateAxpyAVX512(int nk, float a, float const *RESTRICT w, float *RESTRICT v) {
+   __m512 const va = _mm512_set1_ps(a);
+   int k           = 0;
+   for (; k + 16 <= nk; k += 16) {
+      __m512 vv = _mm512_loadu_ps(&v[k]);
+      vv        = _mm512_fmadd_ps(va, _mm512_loadu_ps(&w[k]), vv);
+      _mm512_storeu_ps(&v[k], vv);
+   }
+   if (k < nk) {
+      // Masked loads and stores handle the remainder without a scalar loop.
+      __mmask16 const mask = (__mmask16)((1U << (nk - k)) - 1U);
+      __m512 vv            = _mm512_maskz_loadu_ps(mask, &v[k]);
+      vv                   = _mm512_fmadd_ps(va, _mm512_maskz_loadu_ps(mask, &w[k]), vv);
+      _mm512_mask_storeu_ps(&v[k], mask, vv);
+   }
+}
+
+__attribute__((target("avx512f"))) static void
+accumulateAddAVX512(int nk, float const *RESTRICT w, float *RESTRICT v) {
+   int k = 0;
+   for (; k + 16 <= nk; k += 16) {
+      _mm512_storeu_ps(&v[k], _mm512_add_ps(_mm512_loadu_ps(&v[k]), _mm512_loadu_ps(&w[k])));
+   }
+   if (k < nk) {
+      __mmask16 const mask = (__mmask16)((1U << (nk - k)) - 1U);
+      __m512 const vv      = _mm512_maskz_loadu_ps(mask, &v[k]);
+      _mm512_mask_storeu_ps(&v[k], mask, _mm512_add_ps(vv, _mm512_maskz_loadu_ps(mask, &w[k])));
+   }
+}
+
+__attribute__((target("avx512f"))) static float
+accumulateDotAVX512(int nk, float const *RESTRICT a, float const *RESTRICT w) {
+   __m512 sum = _mm512_setzero_ps();
+   int k      = 0;
+   for (; k + 16 <= nk; k += 16) {
+      sum = _mm512_fmadd_ps(_mm512_loadu_ps(&a[k]), _mm512_loadu_ps(&w[k]), sum);
+   }
+   if (k < nk) {
+      __mmask16 const mask = (__mmask16)((1U << (nk - k)) - 1U);
+      sum                  = _mm512_fmadd_ps(
+            _mm512_maskz_loadu_ps(mask, &a[k]), _mm512_maskz_loadu_ps(mask, &w[k]), sum);
+   }
+   return _mm512_reduce_add_ps(sum);
+}
+
+// The AVX-512 micro-kernel holds an 8-by-32 block of C in sixteen registers.
+__attribute__((target("avx512f"))) static void accumulateGemmAVX512(
+      int m,
+      int n,
+      int k,
+      float alpha,
+      float const *RESTRICT a,
+      int lda,
+      float const *RESTRICT b,
+      int ldb,
+      float *RESTRICT c,
+      int ldc) {
+   int const blockM    = 8;
+   int const blockN    = 32;
+   int const mBlocked  = m - m % blockM;
+   int const nBlocked  = n - n % blockN;
+   __m512 const vAlpha = _mm512_set1_ps(alpha);
+   for (int k0 = 0; k0 < k; k0 += gemmBlockK) {
+      int const kc = std::min(gemmBlockK, k - k0);
+      for (int i = 0; i < mBlocked; i += blockM) {
+         float const *aBlock = &a[i * lda + k0];
+         for (int j = 0; j < nBlocked; j += blockN) {
+            __m512 sum[blockM][2];
+            for (int r = 0; r < blockM; r++) {
+               sum[r][0] = _mm512_setzero_ps();
+               sum[r][1] = _mm512_setzero_ps();
+            }
+            float const *bRow = &b[k0 * ldb + j];
+            for (int kk = 0; kk < kc; kk++, bRow += ldb) {
+               __m512 const b0 = _mm512_loadu_ps(bRow);
+               __m512 const b1 = _mm512_loadu_ps(bRow + 16);
+               for (int r = 0; r < blockM; r++) {
+                  __m512 const ar = _mm512_set1_ps(aBlock[r * lda + kk]);
+                  sum[r][0]       = _mm512_fmadd_ps(ar, b0, sum[r][0]);
+                  sum[r][1]       = _mm512_fmadd_ps(ar, b1, sum[r][1]);
+               }
+            }
+            for (int r = 0; r < blockM; r++) {
+               float *cRow = &c[(i + r) * ldc + j];
+               _mm512_storeu_ps(cRow, _mm512_fmadd_ps(vAlpha, sum[r][0], _mm512_loadu_ps(cRow)));
+               _mm512_storeu_ps(
+                     cRow + 16, _mm512_fmadd_ps(vAlpha, sum[r][1], _mm512_loadu_ps(cRow + 16)));
+            }
+         }
+      }
+   }
+   // The columns to the right of the blocked region, and then the rows below it.
+   accumulateGemmByAxpy(
+         accumulateAxpyAVX512,
+         mBlocked,
+         n - nBlocked,
+         k,
+         alpha,
+         a,
+         lda,
+         &b[nBlocked],
+         ldb,
+         &c[nBlocked],
+         ldc);
+   accumulateGemmByAxpy(
+         accumulateAxpyAVX512,
+         m - mBlocked,
+         n,
+         k,
+         alpha,
+         &a[mBlocked * lda],
+         lda,
+         b,
+         ldb,
+         &c[mBlocked * ldc],
+         ldc);
+}
+#endif // PV_ACCUMULATE_KERNELS_X86
+
+#ifdef PV_ACCUMULATE_KERNELS_NEON
+static void accumulateAxpyNEON(int nk, float a, float const *RESTRICT w, float *RESTRICT v) {
+   float32x4_t const va = vdupq_n_f32(a);
+   int k                = 0;
+   for (; k + 4 <= nk; k += 4) {
+      vst1q_f32(&v[k], vfmaq_f32(vld1q_f32(&v[k]), va, vld1q_f32(&w[k])));
+   }
+   for (; k < nk; k++) {
+      v[k] += a * w[k];
+   }
+}
+
+static void accumulateAddNEON(int nk, float const *RESTRICT w, float *RESTRICT v) {
+   int k = 0;
+   for (; k + 4 <= nk; k += 4) {
+      vst1q_f32(&v[k], vaddq_f32(vld1q_f32(&v[k]), vld1q_f32(&w[k])));
+   }
+   for (; k < nk; k++) {
+      v[k] += w[k];
+   }
+}
+
+static float accumulateDotNEON(int nk, float const *RESTRICT a, float const *RESTRICT w) {
+   float32x4_t sum0 = vdupq_n_f32(0.0f);
+   float32x4_t sum1 = vdupq_n_f32(0.0f);
+   int k            = 0;
+   for (; k + 8 <= nk; k += 8) {
+      sum0 = vfmaq_f32(sum0, vld1q_f32(&a[k]), vld1q_f32(&w[k]));
+      sum1 = vfmaq_f32(sum1, vld1q_f32(&a[k + 4]), vld1q_f32(&w[k + 4]));
+   }
+   if (k + 4 <= nk) {
+      sum0 = vfmaq_f32(sum0, vld1q_f32(&a[k]), vld1q_f32(&w[k]));
+      k += 4;
+   }
+   float dv = vaddvq_f32(vaddq_f32(sum0, sum1));
+   for (; k < nk; k++) {
+      dv += a[k] * w[k];
+   }
+   return dv;
+}
+
+static void accumulateGemmNEON(
+      int m,
+      int n,
+      int k,
+      float alpha,
+      float const *RESTRICT a,
+      int lda,
+      float const *RESTRICT b,
+      int ldb,
+      float *RESTRICT c,
+      int ldc) {
+   accumulateGemmByAxpy(accumulateAxpyNEON, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+}
+#endif // PV_ACCUMULATE_KERNELS_NEON
+
+static AccumulateKernels const accumulateKernelsTable[ACCUMULATE_KERNEL_NUM_VARIANTS] = {
+      {"scalar",
+       accumulateAxpyScalar,
+       accumulateAddScalar,
+       accumulateDotScalar,
+       accumulateGemmScalar},
+#ifdef PV_ACCUMULATE_KERNELS_X86
+      {"avx2", accumulateAxpyAVX2, accumulateAddAVX2, accumulateDotAVX2, accumulateGemmAVX2},
+      {"avx512",
+       accumulateAxpyAVX512,
+       accumulateAddAVX512,
+       accumulateDotAVX512,
+       accumulateGemmAVX512},
+#else
+      {"avx2", nullptr, nullptr, nullptr, nullptr},
+      {"avx512", nullptr, nullptr, nullptr, nullptr},
+#endif // PV_ACCUMULATE_KERNELS_X86
+#ifdef PV_ACCUMULATE_KERNELS_NEON
+      {"neon", accumulateAxpyNEON, accumulateAddNEON, accumulateDotNEON, accumulateGemmNEON},
+#else
+      {"neon", nullptr, nullptr, nullptr, nullptr},
+#endif // PV_ACCUMULATE_KERNELS_NEON
+};
+
+static bool isAccumulateKernelVariantSupported(AccumulateKernelVariant variant) {
+   switch (variant) {
+      case ACCUMULATE_KERNEL_SCALAR: return true;
+#ifdef PV_ACCUMULATE_KERNELS_X86
+      case ACCUMULATE_KERNEL_AVX2:
+         __builtin_cpu_init();
+         return __builtin_cpu_supports("avx2") and __builtin_cpu_supports("fma");
+      case ACCUMULATE_KERNEL_AVX512:
+         __builtin_cpu_init();
+         return __builtin_cpu_supports("avx512f");
+#endif // PV_ACCUMULATE_KERNELS_X86
+#ifdef PV_ACCUMULATE_KERNELS_NEON
+      case ACCUMULATE_KERNEL_NEON: return true;
+#endif // PV_ACCUMULATE_KERNELS_NEON
+      default: return false;
+   }
+}
+
+AccumulateKernels const *getAccumulateKernels(AccumulateKernelVariant variant) {
+   if (variant < 0 or variant >= ACCUMULATE_KERNEL_NUM_VARIANTS) {
+      return nullptr;
+   }
+   return isAccumulateKernelVariantSupported(variant) ? &accumulateKernelsTable[variant] : nullptr;
+}
+
+static AccumulateKernels const *selectAccumulateKernels() {
+   AccumulateKernelVariant const preferenceOrder[] = {
+         ACCUMULATE_KERNEL_AVX512, ACCUMULATE_KERNEL_AVX2, ACCUMULATE_KERNEL_NEON};
+   for (auto variant : preferenceOrder) {
+      AccumulateKernels const *kernels = getAccumulateKernels(variant);
+      if (kernels) {
+         return kernels;
+      }
+   }
+   return &accumulateKernelsTable[ACCUMULATE_KERNEL_SCALAR];
+}
+
+AccumulateKernels const &getAccumulateKernels() {
+   // Function-level static initialization is thread-safe in C++11.
+   static AccumulateKernels const *selectedKernels = selectAccumulateKernels();
+   return *selectedKernels;
+}
+
+} // namespace PV
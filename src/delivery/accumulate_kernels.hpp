@@ -0,0 +1,81 @@
+/*
+ * accumulate_kernels.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef ACCUMULATE_KERNELS_HPP_
+#define ACCUMULATE_KERNELS_HPP_
+
+#include "include/pv_common.h"
+
+namespace PV {
+
+/**
+ * The inner loops of the convolve delivery methods. The presynaptic perspective applies
+ * one row of a patch to the post channel:
+ *    v[k] += a * w[k], for 0 <= k < nk   (axpy)
+ * and the postsynaptic perspective takes the dot product of a row of the activity and a
+ * row of the weights:
+ *    sum of a[k] * w[k], for 0 <= k < nk   (dot)
+ * Spikes are delivered without the multiplication, by adding the row of weights:
+ *    v[k] += w[k], for 0 <= k < nk   (add)
+ * The GEMM delivery mode multiplies a block of weights by a block of packed activity:
+ *    C += alpha * A * B, where A is m-by-k, B is k-by-n, and C is m-by-n   (gemm)
+ * with all three matrices stored in row-major order, with row strides lda, ldb, ldc.
+ *
+ * Each variant implements all four patterns for one instruction set. The variants differ only in
+ * round-off error, since the vectorized dot products sum in a different order and the
+ * vectorized kernels use fused multiply-add instructions.
+ */
+enum AccumulateKernelVariant {
+   ACCUMULATE_KERNEL_SCALAR,
+   ACCUMULATE_KERNEL_AVX2,
+   ACCUMULATE_KERNEL_AVX512,
+   ACCUMULATE_KERNEL_NEON,
+   ACCUMULATE_KERNEL_NUM_VARIANTS
+};
+
+typedef void (*AccumulateAxpyFunction)(
+      int nk,
+      float a,
+      float const *RESTRICT w,
+      float *RESTRICT v);
+typedef void (*AccumulateAddFunction)(int nk, float const *RESTRICT w, float *RESTRICT v);
+typedef float (*AccumulateDotFunction)(int nk, float const *RESTRICT a, float const *RESTRICT w);
+typedef void (*AccumulateGemmFunction)(
+      int m,
+      int n,
+      int k,
+      float alpha,
+      float const *RESTRICT a,
+      int lda,
+      float const *RESTRICT b,
+      int ldb,
+      float *RESTRICT c,
+      int ldc);
+
+struct AccumulateKernels {
+   char const *name;
+   AccumulateAxpyFunction axpy;
+   AccumulateAddFunction add;
+   AccumulateDotFunction dot;
+   AccumulateGemmFunction gemm;
+};
+
+/**
+ * Returns the kernels for the given variant, or nullptr if the variant was not compiled in
+ * or the CPU does not support the instruction set it requires.
+ */
+AccumulateKernels const *getAccumulateKernels(AccumulateKernelVariant variant);
+
+/**
+ * Returns the fastest kernels supported by the CPU. The choice is made the first time the
+ * function is called, and the same kernels are returned on every subsequent call.
+ * Delivery methods should retrieve the kernels once per call to deliver(), outside the loops.
+ */
+AccumulateKernels const &getAccumulateKernels();
+
+} // namespace PV
+
+#endif // ACCUMULATE_KERNELS_HPP_
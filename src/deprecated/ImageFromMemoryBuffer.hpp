@@ -133,6 +133,7 @@ class ImageFromMemoryBuffer : public ImageLayer {
   protected:
    bool hasNewImageFlag; // set to true by setMemoryBuffer; cleared to false by
    // initializeActivity();
+   std::unique_ptr<Image> mImage = nullptr; // the image most recently set by setMemoryBuffer
 }; // class ImageFromMemoryBuffer
 
 } // namespace PV
@@ -104,7 +104,13 @@ Response::Status ShuffleLayer::allocateDataStructures() {
 
 Response::Status
 ShuffleLayer::communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage const> message) {
-   return CloneVLayer::communicateInitInfo(message);
+   auto status = CloneVLayer::communicateInitInfo(message);
+   if (!Response::completed(status)) {
+      return status;
+   }
+   // updateState reads the original layer's data store, not its activity buffer.
+   originalLayer->checkZeroCopyReader(getDescription_c(), getPhase());
+   return status;
 }
 
 int ShuffleLayer::ioParamsFillGroup(enum ParamsIOFlag ioFlag) {
@@ -28,8 +28,8 @@ class FileStream : public PrintStream {
    bool writeable() { return mMode & std::ios_base::out; }
    bool binary() { return mFStream.flags() & std::ios_base::binary; }
    bool readwrite() { return readable() && writeable(); }
-   long getOutPos();
-   long getInPos();
+   virtual long getOutPos();
+   virtual long getInPos();
    std::string const &getFileName() const { return mFileName; }
 
   protected:
@@ -39,9 +39,9 @@ class FileStream : public PrintStream {
 
    std::fstream mFStream;
    std::string mFileName;
+   std::ios_base::openmode mMode;
 
   private:
-   std::ios_base::openmode mMode;
    bool mVerifyWrites     = false;
    int const mMaxAttempts = 5;
 };
@@ -0,0 +1,194 @@
+/*
+ * MappedPvpFile.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "MappedPvpFile.hpp"
+#include "io/io.hpp"
+#include "structures/SparseList.hpp"
+#include "utils/PVAssert.hpp"
+#include "utils/PVLog.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace PV {
+
+MappedPvpFile::MappedPvpFile(std::string const &path) {
+   mPath  = expandLeadingTilde(path);
+   int fd = open(mPath.c_str(), O_RDONLY);
+   FatalIf(fd < 0, "Unable to open \"%s\": %s\n", mPath.c_str(), std::strerror(errno));
+   struct stat fileStat;
+   FatalIf(
+         fstat(fd, &fileStat) != 0,
+         "Unable to stat \"%s\": %s\n",
+         mPath.c_str(),
+         std::strerror(errno));
+   mFileSize = (std::size_t)fileStat.st_size;
+   FatalIf(
+         mFileSize < sizeof(mHeader),
+         "\"%s\" is too short (%zu bytes) to hold a pvp header.\n",
+         mPath.c_str(),
+         mFileSize);
+   void *mapping = mmap(nullptr, mFileSize, PROT_READ, MAP_SHARED, fd, 0);
+   FatalIf(
+         mapping == MAP_FAILED,
+         "Unable to map \"%s\" into memory: %s\n",
+         mPath.c_str(),
+         std::strerror(errno));
+   close(fd); // The mapping keeps the file open.
+   mMapping = static_cast<char const *>(mapping);
+
+   checkHeader();
+   buildFrameTable();
+}
+
+MappedPvpFile::~MappedPvpFile() {
+   if (mMapping) {
+      munmap(const_cast<char *>(mMapping), mFileSize);
+   }
+}
+
+void MappedPvpFile::checkHeader() {
+   std::memcpy(&mHeader, mMapping, sizeof(mHeader));
+   FatalIf(
+         mHeader.headerSize < (int)sizeof(mHeader) || (std::size_t)mHeader.headerSize > mFileSize,
+         "\"%s\" has a bad headerSize field %d.\n",
+         mPath.c_str(),
+         mHeader.headerSize);
+   FatalIf(
+         mHeader.nBands <= 0,
+         "\"%s\" header does not have a positive nbands field.\n",
+         mPath.c_str());
+   std::size_t expectedDataSize = (std::size_t)0;
+   switch (mHeader.fileType) {
+      case PVP_NONSPIKING_ACT_FILE_TYPE: expectedDataSize = sizeof(float); break;
+      case PVP_ACT_SPARSEVALUES_FILE_TYPE:
+         expectedDataSize = sizeof(struct SparseList<float>::Entry);
+         break;
+      case PVP_ACT_FILE_TYPE: expectedDataSize = sizeof(std::uint32_t); break;
+      default:
+         Fatal().printf(
+               "\"%s\" has file type %d, which is not an activity file type.\n",
+               mPath.c_str(),
+               mHeader.fileType);
+         break;
+   }
+   FatalIf(
+         mHeader.dataSize != (int)expectedDataSize,
+         "\"%s\" has data size %d; expected %zu for file type %d.\n",
+         mPath.c_str(),
+         mHeader.dataSize,
+         expectedDataSize,
+         mHeader.fileType);
+   if (mHeader.fileType == PVP_NONSPIKING_ACT_FILE_TYPE) {
+      // Older files give the record size in bytes instead of values. The frames themselves are
+      // laid out the same way, so both are accepted, and the frame size is taken from nx*ny*nf.
+      int const numValues = mHeader.nx * mHeader.ny * mHeader.nf;
+      FatalIf(
+            mHeader.recordSize != numValues and mHeader.recordSize != numValues * mHeader.dataSize,
+            "\"%s\" has record size %d, but nx*ny*nf is %d.\n",
+            mPath.c_str(),
+            mHeader.recordSize,
+            numValues);
+   }
+}
+
+void MappedPvpFile::buildFrameTable() {
+   int const numFrames = mHeader.nBands;
+   mFrameOffsets.resize(numFrames);
+   std::size_t offset = (std::size_t)mHeader.headerSize;
+   for (int f = 0; f < numFrames; f++) {
+      mFrameOffsets[f]        = offset;
+      std::size_t numValues   = (std::size_t)(mHeader.nx * mHeader.ny * mHeader.nf);
+      std::size_t frameHeader = sizeof(double);
+      if (mHeader.fileType != PVP_NONSPIKING_ACT_FILE_TYPE) {
+         FatalIf(
+               offset + sizeof(double) + sizeof(int) > mFileSize,
+               "\"%s\" ends in the middle of frame %d.\n",
+               mPath.c_str(),
+               f);
+         int numActive;
+         std::memcpy(&numActive, &mMapping[offset + sizeof(double)], sizeof(int));
+         FatalIf(
+               numActive < 0,
+               "\"%s\" frame %d has a negative number of active neurons.\n",
+               mPath.c_str(),
+               f);
+         numValues   = (std::size_t)numActive;
+         frameHeader = sizeof(double) + sizeof(int);
+      }
+      offset += frameHeader + numValues * (std::size_t)mHeader.dataSize;
+      FatalIf(
+            offset > mFileSize,
+            "\"%s\" ends in the middle of frame %d.\n",
+            mPath.c_str(),
+            f);
+   }
+}
+
+MappedPvpFile::Frame MappedPvpFile::getFrame(int frameIndex) const {
+   FatalIf(frameIndex < 0, "\"%s\": frame index %d is negative.\n", mPath.c_str(), frameIndex);
+   std::size_t offset = mFrameOffsets[frameIndex % getNumFrames()];
+   Frame frame;
+   std::memcpy(&frame.timestamp, &mMapping[offset], sizeof(double));
+   offset += sizeof(double);
+   if (mHeader.fileType == PVP_NONSPIKING_ACT_FILE_TYPE) {
+      frame.numValues = mHeader.nx * mHeader.ny * mHeader.nf;
+   }
+   else {
+      std::memcpy(&frame.numValues, &mMapping[offset], sizeof(int));
+      offset += sizeof(int);
+   }
+   frame.data = &mMapping[offset];
+   return frame;
+}
+
+double MappedPvpFile::readFrame(int frameIndex, Buffer<float> *buffer) const {
+   Frame frame = getFrame(frameIndex);
+   buffer->resize(mHeader.nx, mHeader.ny, mHeader.nf);
+   int const numNeurons = buffer->getTotalElements();
+   switch (mHeader.fileType) {
+      case PVP_NONSPIKING_ACT_FILE_TYPE: {
+         float const *values = static_cast<float const *>(frame.data);
+         for (int k = 0; k < numNeurons; k++) {
+            buffer->set(k, values[k]);
+         }
+      } break;
+      case PVP_ACT_SPARSEVALUES_FILE_TYPE: {
+         auto const *entries = static_cast<struct SparseList<float>::Entry const *>(frame.data);
+         for (int n = 0; n < frame.numValues; n++) {
+            std::uint32_t k = entries[n].index;
+            FatalIf(
+                  k >= (std::uint32_t)numNeurons,
+                  "\"%s\" frame %d has out-of-range index %u.\n",
+                  mPath.c_str(),
+                  frameIndex,
+                  (unsigned)k);
+            buffer->set((int)k, entries[n].value);
+         }
+      } break;
+      case PVP_ACT_FILE_TYPE: {
+         std::uint32_t const *indices = static_cast<std::uint32_t const *>(frame.data);
+         for (int n = 0; n < frame.numValues; n++) {
+            std::uint32_t k = indices[n];
+            FatalIf(
+                  k >= (std::uint32_t)numNeurons,
+                  "\"%s\" frame %d has out-of-range index %u.\n",
+                  mPath.c_str(),
+                  frameIndex,
+                  (unsigned)k);
+            buffer->set((int)k, 1.0f);
+         }
+      } break;
+      default: pvAssert(0); break;
+   }
+   return frame.timestamp;
+}
+
+} // namespace PV
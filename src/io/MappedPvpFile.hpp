@@ -0,0 +1,75 @@
+/*
+ * MappedPvpFile.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef MAPPEDPVPFILE_HPP_
+#define MAPPEDPVPFILE_HPP_
+
+#include "structures/Buffer.hpp"
+#include "utils/BufferUtilsPvp.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace PV {
+
+/**
+ * A read-only view of an activity pvp file (dense, sparse-values, or sparse-binary), for
+ * playing a pvp file as a movie without reopening it for every frame.
+ * The constructor maps the whole file into memory, checks the header, and builds a table of
+ * the offset of every frame, so that looking up a frame takes constant time and reads only the
+ * pages that hold that frame. Frames are returned as views into the mapping, without copying.
+ * The views are valid until the MappedPvpFile is deleted.
+ */
+class MappedPvpFile {
+  public:
+   /**
+    * A frame of the file. For a dense file, numValues is the number of elements in the frame and
+    * data points to that many floats. For a sparse-values file, numValues is the number of
+    * active neurons and data points to that many {uint32 index, float value} pairs. For a
+    * sparse-binary file, numValues is the number of active neurons and data points to that many
+    * 32-bit indices.
+    */
+   struct Frame {
+      double timestamp;
+      int numValues;
+      void const *data;
+   };
+
+   MappedPvpFile(std::string const &path);
+   ~MappedPvpFile();
+
+   /**
+    * Returns the given frame. The index is taken modulo the number of frames in the file.
+    */
+   Frame getFrame(int frameIndex) const;
+
+   /**
+    * Copies the given frame into the buffer, resizing the buffer to the nx-by-ny-by-nf size in
+    * the header. Sparse frames are scattered into a buffer of zeroes, and the active neurons of
+    * a sparse-binary frame have the value one. Returns the frame's timestamp.
+    */
+   double readFrame(int frameIndex, Buffer<float> *buffer) const;
+
+   BufferUtils::ActivityHeader const &getHeader() const { return mHeader; }
+   int getNumFrames() const { return mHeader.nBands; }
+   std::string const &getPath() const { return mPath; }
+
+  private:
+   void checkHeader();
+   void buildFrameTable();
+
+  private:
+   std::string mPath;
+   char const *mMapping   = nullptr;
+   std::size_t mFileSize  = (std::size_t)0;
+   BufferUtils::ActivityHeader mHeader;
+   std::vector<std::size_t> mFrameOffsets;
+};
+
+} // namespace PV
+
+#endif // MAPPEDPVPFILE_HPP_
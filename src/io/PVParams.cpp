@@ -191,13 +191,24 @@ ParameterStack::~ParameterStack() {
  */
 int ParameterStack::push(Parameter *param) {
    assert(count < maxCount);
+   mNameIndex.emplace(param->name(), count);
    parameters[count++] = param;
    return 0;
 }
 
 Parameter *ParameterStack::pop() {
    assert(count > 0);
-   return parameters[count--];
+   Parameter *param = parameters[--count];
+   auto found       = mNameIndex.find(param->name());
+   if (found != mNameIndex.end() && found->second == count) {
+      mNameIndex.erase(found);
+   }
+   return param;
+}
+
+int ParameterStack::find(const char *name) {
+   auto found = mNameIndex.find(name);
+   return found == mNameIndex.end() ? -1 : found->second;
 }
 
 ParameterArrayStack::ParameterArrayStack(int initialCount) {
@@ -238,11 +249,18 @@ int ParameterArrayStack::push(ParameterArray *array) {
       parameterArrays = newParameterArrays;
    }
    assert(count < allocation);
+   assert(array->name() != NULL);
+   mNameIndex.emplace(array->name(), count);
    parameterArrays[count] = array;
    count++;
    return PV_SUCCESS;
 }
 
+int ParameterArrayStack::find(const char *name) {
+   auto found = mNameIndex.find(name);
+   return found == mNameIndex.end() ? -1 : found->second;
+}
+
 /*
  * initialCount
  */
@@ -278,26 +296,32 @@ int ParameterStringStack::push(ParameterString *param) {
       parameterStrings = newparameterStrings;
    }
    assert(count < allocation);
+   mNameIndex.emplace(param->getName(), count);
    parameterStrings[count++] = param;
    return PV_SUCCESS;
 }
 
 ParameterString *ParameterStringStack::pop() {
    if (count > 0) {
-      return parameterStrings[count--];
+      ParameterString *param = parameterStrings[--count];
+      auto found             = mNameIndex.find(param->getName());
+      if (found != mNameIndex.end() && found->second == count) {
+         mNameIndex.erase(found);
+      }
+      return param;
    }
    else
       return NULL;
 }
 
+int ParameterStringStack::find(const char *name) {
+   auto found = mNameIndex.find(name);
+   return found == mNameIndex.end() ? -1 : found->second;
+}
+
 const char *ParameterStringStack::lookup(const char *targetname) {
-   const char *result = NULL;
-   for (int i = 0; i < count; i++) {
-      if (!strcmp(parameterStrings[i]->getName(), targetname)) {
-         result = parameterStrings[i]->getValue();
-      }
-   }
-   return result;
+   int const index = find(targetname);
+   return index < 0 ? NULL : parameterStrings[index]->getValue();
 }
 
 /**
@@ -357,27 +381,15 @@ int ParameterGroup::setStringStack(ParameterStringStack *stringStack) {
 /**
  * @name
  */
-int ParameterGroup::present(const char *name) {
-   int count = stack->size();
-   for (int i = 0; i < count; i++) {
-      Parameter *p = stack->peek(i);
-      if (strcmp(name, p->name()) == 0) {
-         return 1; // string is present
-      }
-   }
-   return 0; // string not present
-}
+int ParameterGroup::present(const char *name) { return stack->find(name) >= 0 ? 1 : 0; }
 
 /**
  * @name
  */
 double ParameterGroup::value(const char *name) {
-   int count = stack->size();
-   for (int i = 0; i < count; i++) {
-      Parameter *p = stack->peek(i);
-      if (strcmp(name, p->name()) == 0) {
-         return p->value();
-      }
+   int index = stack->find(name);
+   if (index >= 0) {
+      return stack->peek(index)->value();
    }
    Fatal().printf(
          "PVParams::ParameterGroup::value: ERROR, couldn't find a value for %s"
@@ -388,43 +400,22 @@ double ParameterGroup::value(const char *name) {
 }
 
 bool ParameterGroup::arrayPresent(const char *name) {
-   bool array_found = false;
-   int count       = arrayStack->size();
-   for (int i = 0; i < count; i++) {
-      ParameterArray *p = arrayStack->peek(i);
-      if (strcmp(name, p->name()) == 0) {
-         array_found = true; // string is present
-         break;
-      }
-   }
+   bool array_found = arrayStack->find(name) >= 0;
    if (!array_found) { array_found = (present(name) != 0); }
    return array_found;
 }
 
 const float *ParameterGroup::arrayValues(const char *name, int *size) {
-   int count         = arrayStack->size();
-   *size             = 0;
-   const float *v    = NULL;
-   ParameterArray *p = NULL;
-   for (int i = 0; i < count; i++) {
-      p = arrayStack->peek(i);
-      if (strcmp(name, p->name()) == 0) {
-         v = p->getValues(size);
-         break;
-      }
+   *size          = 0;
+   const float *v = NULL;
+   int index      = arrayStack->find(name);
+   if (index >= 0) {
+      v = arrayStack->peek(index)->getValues(size);
    }
    if (!v) {
-      Parameter *q = NULL;
-      for (int i = 0; i < stack->size(); i++) {
-         Parameter *q1 = stack->peek(i);
-         assert(q1);
-         if (strcmp(name, q1->name()) == 0) {
-            q = q1;
-            break;
-         }
-      }
-      if (q) {
-         v     = q->valuePtr();
+      index = stack->find(name);
+      if (index >= 0) {
+         v     = stack->peek(index)->valuePtr();
          *size = 1;
       }
    }
@@ -432,29 +423,16 @@ const float *ParameterGroup::arrayValues(const char *name, int *size) {
 }
 
 const double *ParameterGroup::arrayValuesDbl(const char *name, int *size) {
-   int count         = arrayStack->size();
-   *size             = 0;
-   const double *v   = NULL;
-   ParameterArray *p = NULL;
-   for (int i = 0; i < count; i++) {
-      p = arrayStack->peek(i);
-      if (strcmp(name, p->name()) == 0) {
-         v = p->getValuesDbl(size);
-         break;
-      }
+   *size           = 0;
+   const double *v = NULL;
+   int index       = arrayStack->find(name);
+   if (index >= 0) {
+      v = arrayStack->peek(index)->getValuesDbl(size);
    }
    if (!v) {
-      Parameter *q = NULL;
-      for (int i = 0; i < stack->size(); i++) {
-         Parameter *q1 = stack->peek(i);
-         assert(q1);
-         if (strcmp(name, q1->name()) == 0) {
-            q = q1;
-            break;
-         }
-      }
-      if (q) {
-         v     = q->valueDblPtr();
+      index = stack->find(name);
+      if (index >= 0) {
+         v     = stack->peek(index)->valueDblPtr();
          *size = 1;
       }
    }
@@ -467,29 +445,14 @@ int ParameterGroup::stringPresent(const char *stringName) {
    // value and present methods for floating-point parameters
    if (!stringName)
       return 0;
-   int count = stringStack->size();
-   for (int i = 0; i < count; i++) {
-      ParameterString *pstr = stringStack->peek(i);
-      assert(pstr);
-      if (!strcmp(stringName, pstr->getName())) {
-         return 1; // string is present
-      }
-   }
-   return 0; // string not present
+   return stringStack->find(stringName) >= 0 ? 1 : 0;
 }
 
 const char *ParameterGroup::stringValue(const char *stringName) {
    if (!stringName)
       return NULL;
-   int count = stringStack->size();
-   for (int i = 0; i < count; i++) {
-      ParameterString *pstr = stringStack->peek(i);
-      assert(pstr);
-      if (!strcmp(stringName, pstr->getName())) {
-         return pstr->getValue();
-      }
-   }
-   return NULL;
+   int index = stringStack->find(stringName);
+   return index >= 0 ? stringStack->peek(index)->getValue() : NULL;
 }
 
 int ParameterGroup::warnUnread() {
@@ -534,27 +497,17 @@ int ParameterGroup::warnUnread() {
 }
 
 bool ParameterGroup::hasBeenRead(const char *paramName) {
-   int count;
-   count = stack->size();
-   for (int i = 0; i < count; i++) {
-      Parameter *p = stack->peek(i);
-      if (!strcmp(p->name(), paramName)) {
-         return p->hasBeenRead();
-      }
+   int index = stack->find(paramName);
+   if (index >= 0) {
+      return stack->peek(index)->hasBeenRead();
    }
-   count = arrayStack->size();
-   for (int i = 0; i < count; i++) {
-      ParameterArray *parr = arrayStack->peek(i);
-      if (!strcmp(parr->name(), paramName)) {
-         return parr->hasBeenRead();
-      }
+   index = arrayStack->find(paramName);
+   if (index >= 0) {
+      return arrayStack->peek(index)->hasBeenRead();
    }
-   count = stringStack->size();
-   for (int i = 0; i < count; i++) {
-      ParameterString *pstr = stringStack->peek(i);
-      if (!strcmp(pstr->getName(), paramName)) {
-         return pstr->hasBeenRead();
-      }
+   index = stringStack->find(paramName);
+   if (index >= 0) {
+      return stringStack->peek(index)->hasBeenRead();
    }
    return false;
 }
@@ -585,13 +538,10 @@ int ParameterGroup::pushString(ParameterString *param) { return stringStack->pus
 
 int ParameterGroup::setValue(const char *param_name, double value) {
    int status = PV_SUCCESS;
-   int count  = stack->size();
-   for (int i = 0; i < count; i++) {
-      Parameter *p = stack->peek(i);
-      if (strcmp(param_name, p->name()) == 0) {
-         p->setValue(value);
-         return PV_SUCCESS;
-      }
+   int index  = stack->find(param_name);
+   if (index >= 0) {
+      stack->peek(index)->setValue(value);
+      return PV_SUCCESS;
    }
    Fatal().printf(
          "PVParams::ParameterGroup::setValue: ERROR, couldn't find parameter %s"
@@ -604,13 +554,10 @@ int ParameterGroup::setValue(const char *param_name, double value) {
 
 int ParameterGroup::setStringValue(const char *param_name, const char *svalue) {
    int status = PV_SUCCESS;
-   int count  = stringStack->size();
-   for (int i = 0; i < count; i++) {
-      ParameterString *p = stringStack->peek(i);
-      if (strcmp(param_name, p->getName()) == 0) {
-         p->setValue(svalue);
-         return PV_SUCCESS;
-      }
+   int index  = stringStack->find(param_name);
+   if (index >= 0) {
+      stringStack->peek(index)->setValue(svalue);
+      return PV_SUCCESS;
    }
    Fatal().printf(
          "PVParams::ParameterGroup::setStringValue: ERROR, couldn't find a string value for %s"
@@ -1554,12 +1501,8 @@ void PVParams::writeParamString(const char *paramName, const char *svalue) {
  * @groupName
  */
 ParameterGroup *PVParams::group(const char *groupName) {
-   for (int i = 0; i < numGroups; i++) {
-      if (strcmp(groupName, groups[i]->name()) == 0) {
-         return groups[i];
-      }
-   }
-   return NULL;
+   auto found = mGroupIndex.find(groupName);
+   return found == mGroupIndex.end() ? NULL : groups[found->second];
 }
 
 const char *PVParams::groupNameFromIndex(int index) {
@@ -1589,10 +1532,8 @@ void PVParams::addGroup(char *keyword, char *name) {
    assert((size_t)numGroups <= groupArraySize);
 
    // Verify that the new group's name is not an existing group's name
-   for (int k = 0; k < numGroups; k++) {
-      if (!strcmp(name, groups[k]->name())) {
-         Fatal().printf("Rank %d process: group name \"%s\" duplicated\n", worldRank, name);
-      }
+   if (group(name) != NULL) {
+      Fatal().printf("Rank %d process: group name \"%s\" duplicated\n", worldRank, name);
    }
 
    if ((size_t)numGroups == groupArraySize) {
@@ -1609,6 +1550,7 @@ void PVParams::addGroup(char *keyword, char *name) {
 
    groups[numGroups] = new ParameterGroup(name, stack, arrayStack, stringStack, worldRank);
    groups[numGroups]->setGroupKeyword(keyword);
+   mGroupIndex.emplace(groups[numGroups]->name(), numGroups);
 
    // the parameter group takes over control of the PVParams's stack and stringStack; make new ones.
    stack       = new ParameterStack(MAX_PARAMS);
@@ -1922,24 +1864,16 @@ void PVParams::action_parameter_def_overwrite(char *id, double val) {
    }
    // Search through current parameters for the id
    char *param_name     = stripOverwriteTag(id);
-   Parameter *currParam = NULL;
-   for (int i = 0; i < stack->size(); i++) {
-      Parameter *param = stack->peek(i);
-      if (strcmp(param->name(), param_name) == 0) {
-         currParam = param;
-      }
-   }
+   int const paramIndex = stack->find(param_name);
+   Parameter *currParam = paramIndex < 0 ? NULL : stack->peek(paramIndex);
    if (!currParam) {
-      for (int i = 0; i < arrayStack->size(); i++) {
-         ParameterArray *arrayParam = arrayStack->peek(i);
-         if (strcmp(arrayParam->name(), param_name) == 0) {
-            InfoLog().flush();
-            InfoLog().printf(
-                  "%s is defined as an array parameter. Overwriting array parameters with value "
-                  "parameters not implemented yet.\n",
-                  id);
-            InfoLog().flush();
-         }
+      if (arrayStack->find(param_name) >= 0) {
+         InfoLog().flush();
+         InfoLog().printf(
+               "%s is defined as an array parameter. Overwriting array parameters with value "
+               "parameters not implemented yet.\n",
+               id);
+         InfoLog().flush();
       }
       InfoLog().flush();
       ErrorLog().printf("Overwrite: %s is not an existing parameter to overwrite.\n", id);
@@ -1975,24 +1909,16 @@ void PVParams::action_parameter_array_overwrite(char *id) {
    }
    // Search through current parameters for the id
    char *param_name          = stripOverwriteTag(id);
-   ParameterArray *origArray = NULL;
-   for (int i = 0; i < arrayStack->size(); i++) {
-      ParameterArray *arrayParam = arrayStack->peek(i);
-      if (strcmp(arrayParam->name(), param_name) == 0) {
-         origArray = arrayParam;
-      }
-   }
+   int const arrayIndex      = arrayStack->find(param_name);
+   ParameterArray *origArray = arrayIndex < 0 ? NULL : arrayStack->peek(arrayIndex);
    if (!origArray) {
-      for (int i = 0; i < stack->size(); i++) {
-         Parameter *param = stack->peek(i);
-         if (strcmp(param->name(), param_name) == 0) {
-            InfoLog().flush();
-            InfoLog().printf(
-                  "%s is defined as a value parameter. Overwriting value parameters with array "
-                  "parameters not implemented yet.\n",
-                  id);
-            InfoLog().flush();
-         }
+      if (stack->find(param_name) >= 0) {
+         InfoLog().flush();
+         InfoLog().printf(
+               "%s is defined as a value parameter. Overwriting value parameters with array "
+               "parameters not implemented yet.\n",
+               id);
+         InfoLog().flush();
       }
       InfoLog().flush();
       ErrorLog().printf("Overwrite: %s is not an existing parameter to overwrite.\n", id);
@@ -2048,14 +1974,8 @@ void PVParams::action_parameter_string_def_overwrite(const char *id, const char
    }
    // Search through current parameters for the id
    char *param_name           = stripOverwriteTag(id);
-   ParameterString *currParam = NULL;
-   for (int i = 0; i < stringStack->size(); i++) {
-      ParameterString *param = stringStack->peek(i);
-      assert(param);
-      if (strcmp(param->getName(), param_name) == 0) {
-         currParam = param;
-      }
-   }
+   int const stringIndex      = stringStack->find(param_name);
+   ParameterString *currParam = stringIndex < 0 ? NULL : stringStack->peek(stringIndex);
    free(param_name);
    if (!currParam) {
       ErrorLog().printf("Overwrite: %s is not an existing parameter to overwrite.\n", id);
@@ -2094,14 +2014,8 @@ void PVParams::action_parameter_filename_def_overwrite(const char *id, const cha
    }
    // Search through current parameters for the id
    char *param_name           = stripOverwriteTag(id);
-   ParameterString *currParam = NULL;
-   for (int i = 0; i < stringStack->size(); i++) {
-      ParameterString *param = stringStack->peek(i);
-      assert(param);
-      if (strcmp(param->getName(), param_name) == 0) {
-         currParam = param;
-      }
-   }
+   int const stringIndex      = stringStack->find(param_name);
+   ParameterString *currParam = stringIndex < 0 ? NULL : stringStack->peek(stringIndex);
    free(param_name);
    param_name = NULL;
    if (!currParam) {
@@ -2130,13 +2044,7 @@ void PVParams::action_include_directive(const char *stringval) {
    // Grab the parameter value
    char *param_value = stripQuotationMarks(stringval);
    // Grab the included group's ParameterGroup object
-   ParameterGroup *includeGroup = NULL;
-   for (int groupidx = 0; groupidx < numGroups; groupidx++) {
-      // If strings are matching
-      if (strcmp(groups[groupidx]->name(), param_value) == 0) {
-         includeGroup = groups[groupidx];
-      }
-   }
+   ParameterGroup *includeGroup = group(param_value);
    // If group not found
    if (!includeGroup) {
       ErrorLog().printf("Include: include group %s is not defined.\n", param_value);
@@ -2241,42 +2149,35 @@ void PVParams::action_parameter_sweep_values_filename(const char *stringval) {
 
 void PVParams::checkDuplicates(const char *paramName) {
    bool hasDuplicate = false;
-   for (int k = 0; k < stack->size(); k++) {
-      Parameter *parm = stack->peek(k);
-      if (!strcmp(paramName, parm->name())) {
-         ErrorLog().printf(
-               "Rank %d process: The params group for %s \"%s\" duplicates "
-               "parameter \"%s\".\n",
-               worldRank,
-               currGroupKeyword,
-               currGroupName,
-               paramName);
-         hasDuplicate = true;
-      }
+   if (stack->find(paramName) >= 0) {
+      ErrorLog().printf(
+            "Rank %d process: The params group for %s \"%s\" duplicates "
+            "parameter \"%s\".\n",
+            worldRank,
+            currGroupKeyword,
+            currGroupName,
+            paramName);
+      hasDuplicate = true;
    }
-   for (int k = 0; k < arrayStack->size(); k++) {
-      if (!strcmp(paramName, arrayStack->peek(k)->name())) {
-         ErrorLog().printf(
-               "Rank %d process: The params group for %s \"%s\" duplicates "
-               "array parameter \"%s\".\n",
-               worldRank,
-               currGroupKeyword,
-               currGroupName,
-               paramName);
-         hasDuplicate = true;
-      }
+   if (arrayStack->find(paramName) >= 0) {
+      ErrorLog().printf(
+            "Rank %d process: The params group for %s \"%s\" duplicates "
+            "array parameter \"%s\".\n",
+            worldRank,
+            currGroupKeyword,
+            currGroupName,
+            paramName);
+      hasDuplicate = true;
    }
-   for (int k = 0; k < stringStack->size(); k++) {
-      if (!strcmp(paramName, stringStack->peek(k)->getName())) {
-         ErrorLog().printf(
-               "Rank %d process: The params group for %s \"%s\" duplicates "
-               "string parameter \"%s\".\n",
-               worldRank,
-               currGroupKeyword,
-               currGroupName,
-               paramName);
-         hasDuplicate = true;
-      }
+   if (stringStack->find(paramName) >= 0) {
+      ErrorLog().printf(
+            "Rank %d process: The params group for %s \"%s\" duplicates "
+            "string parameter \"%s\".\n",
+            worldRank,
+            currGroupKeyword,
+            currGroupName,
+            paramName);
+      hasDuplicate = true;
    }
    if (hasDuplicate) {
       exit(EXIT_FAILURE);
@@ -18,6 +18,7 @@
 #include <cstring>
 #include <limits>
 #include <sstream>
+#include <unordered_map>
 
 // TODO - make MAX_PARAMS dynamic
 #define MAX_PARAMS 100 // maximum number of parameters in a group
@@ -26,6 +27,30 @@
 
 namespace PV {
 
+/**
+ * Hashes a C string by its contents (FNV-1a), so that the lookup tables below can be keyed by
+ * the names that the parameters and groups own, without copying them.
+ */
+struct ParamsNameHash {
+   std::size_t operator()(char const *name) const {
+      std::size_t hash = (std::size_t)2166136261U;
+      for (char const *c = name; *c; c++) {
+         hash = (hash ^ (std::size_t)(unsigned char)*c) * (std::size_t)16777619U;
+      }
+      return hash;
+   }
+};
+
+struct ParamsNameEqual {
+   bool operator()(char const *a, char const *b) const { return strcmp(a, b) == 0; }
+};
+
+/**
+ * Maps a name to the index of the first entry with that name. The keys point to the names
+ * owned by the entries, and so are valid as long as the entries are.
+ */
+typedef std::unordered_map<char const *, int, ParamsNameHash, ParamsNameEqual> ParamsNameIndex;
+
 class Parameter {
   public:
    Parameter(const char *name, double value);
@@ -127,10 +152,16 @@ class ParameterStack {
    Parameter *peek(int index) { return parameters[index]; }
    int size() { return count; }
 
+   /**
+    * Returns the index of the first parameter with the given name, or -1 if there is none.
+    */
+   int find(const char *name);
+
   private:
    int count;
    int maxCount;
    Parameter **parameters;
+   ParamsNameIndex mNameIndex;
 };
 
 class ParameterArrayStack {
@@ -143,10 +174,17 @@ class ParameterArrayStack {
       return index >= 0 && index < count ? parameterArrays[index] : NULL;
    }
 
+   /**
+    * Returns the index of the first array with the given name, or -1 if there is none.
+    * The array's name must be set before it is pushed.
+    */
+   int find(const char *name);
+
   private:
    int count; // Number of ParameterArrays
    int allocation; // Size of buffer
    ParameterArray **parameterArrays;
+   ParamsNameIndex mNameIndex;
 };
 
 class ParameterStringStack {
@@ -162,10 +200,16 @@ class ParameterStringStack {
    int size() { return count; }
    const char *lookup(const char *targetname);
 
+   /**
+    * Returns the index of the first string with the given name, or -1 if there is none.
+    */
+   int find(const char *name);
+
   private:
    int count;
    int allocation;
    ParameterString **parameterStrings;
+   ParamsNameIndex mNameIndex;
 };
 
 class ParameterGroup {
@@ -379,6 +423,7 @@ class PVParams {
    int numGroups;
    size_t groupArraySize;
    ParameterGroup **groups;
+   ParamsNameIndex mGroupIndex; // Indices into groups, by group name
    ParameterStack *stack;
    ParameterArrayStack *arrayStack;
    ParameterStringStack *stringStack;
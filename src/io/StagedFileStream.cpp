@@ -0,0 +1,105 @@
+/*
+ * StagedFileStream.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "StagedFileStream.hpp"
+#include "io/io.hpp"
+#include "utils/PVLog.hpp"
+
+#include <cstring>
+
+namespace PV {
+
+StagedFileStream::StagedFileStream(char const *path)
+      : mContents(std::make_shared<std::vector<char>>()),
+        mContentsBuffer(mContents.get()),
+        mContentsStream(&mContentsBuffer) {
+   setOutStream(mContentsStream);
+   mFileName = expandLeadingTilde(path);
+   mMode     = std::ios_base::out | std::ios_base::binary;
+}
+
+StagedFileStream::~StagedFileStream() {}
+
+void StagedFileStream::write(void const *data, long length) {
+   mContentsStream.write((char const *)data, length);
+   verifyState("write");
+}
+
+void StagedFileStream::read(void *data, long length) {
+   Fatal() << "StagedFileStream \"" << mFileName << "\" cannot be read.\n";
+}
+
+void StagedFileStream::setOutPos(long pos, std::ios_base::seekdir seekAnchor) {
+   mContentsStream.seekp(pos, seekAnchor);
+   verifyState("setOutPos");
+}
+
+void StagedFileStream::setOutPos(long pos, bool fromBeginning) {
+   setOutPos(pos, fromBeginning ? std::ios_base::beg : std::ios_base::cur);
+}
+
+void StagedFileStream::setInPos(long pos, std::ios_base::seekdir seekAnchor) {
+   Fatal() << "StagedFileStream \"" << mFileName << "\" cannot be read.\n";
+}
+
+void StagedFileStream::setInPos(long pos, bool fromBeginning) {
+   Fatal() << "StagedFileStream \"" << mFileName << "\" cannot be read.\n";
+}
+
+long StagedFileStream::getOutPos() { return mContentsStream.tellp(); }
+
+long StagedFileStream::getInPos() { return -1L; }
+
+void StagedFileStream::verifyState(char const *caller) {
+   FatalIf(mContentsStream.fail(), "%s %s: Logical error.\n", mFileName.c_str(), caller);
+}
+
+std::streamsize StagedFileStream::ContentsBuffer::xsputn(char const *s, std::streamsize n) {
+   if (n <= 0) {
+      return 0;
+   }
+   std::size_t const end = mPosition + (std::size_t)n;
+   if (end > mContents->size()) {
+      mContents->resize(end);
+   }
+   std::memcpy(&mContents->at(mPosition), s, (std::size_t)n);
+   mPosition = end;
+   return n;
+}
+
+StagedFileStream::ContentsBuffer::int_type
+StagedFileStream::ContentsBuffer::overflow(int_type c) {
+   if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      char const ch = traits_type::to_char_type(c);
+      xsputn(&ch, 1);
+   }
+   return traits_type::not_eof(c);
+}
+
+StagedFileStream::ContentsBuffer::pos_type StagedFileStream::ContentsBuffer::seekoff(
+      off_type off,
+      std::ios_base::seekdir dir,
+      std::ios_base::openmode) {
+   off_type base;
+   switch (dir) {
+      case std::ios_base::beg: base = (off_type)0; break;
+      case std::ios_base::cur: base = (off_type)mPosition; break;
+      case std::ios_base::end: base = (off_type)mContents->size(); break;
+      default: return pos_type(off_type(-1));
+   }
+   if (base + off < (off_type)0) {
+      return pos_type(off_type(-1));
+   }
+   mPosition = (std::size_t)(base + off);
+   return pos_type((off_type)mPosition);
+}
+
+StagedFileStream::ContentsBuffer::pos_type
+StagedFileStream::ContentsBuffer::seekpos(pos_type pos, std::ios_base::openmode which) {
+   return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+} /* namespace PV */
@@ -0,0 +1,71 @@
+/*
+ * StagedFileStream.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef STAGEDFILESTREAM_HPP_
+#define STAGEDFILESTREAM_HPP_
+
+#include "FileStream.hpp"
+
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
+namespace PV {
+
+/**
+ * A write-only FileStream whose contents are kept in memory instead of being written to the file.
+ * The contents are held in a shared vector that outlives the stream, so that the file can be
+ * written later, possibly by another thread, after whoever opened the stream has deleted it.
+ * As with a file, seeking past the end and then writing fills the gap with zeroes.
+ */
+class StagedFileStream : public FileStream {
+  public:
+   StagedFileStream(char const *path);
+   virtual ~StagedFileStream();
+   virtual void write(void const *data, long length) override;
+   virtual void read(void *data, long length) override;
+   virtual void setOutPos(long pos, std::ios_base::seekdir seekAnchor) override;
+   virtual void setOutPos(long pos, bool fromBeginning) override;
+   virtual void setInPos(long pos, std::ios_base::seekdir seekAnchor) override;
+   virtual void setInPos(long pos, bool fromBeginning) override;
+   virtual long getOutPos() override;
+   virtual long getInPos() override;
+
+   std::shared_ptr<std::vector<char> const> getContents() const { return mContents; }
+
+  private:
+   /**
+    * The stream buffer that the PrintStream methods write through. It writes into the contents
+    * vector at the current position, growing the vector as needed.
+    */
+   class ContentsBuffer : public std::streambuf {
+     public:
+      ContentsBuffer(std::vector<char> *contents) : mContents(contents) {}
+
+     protected:
+      virtual std::streamsize xsputn(char const *s, std::streamsize n) override;
+      virtual int_type overflow(int_type c) override;
+      virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode)
+            override;
+      virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+
+     private:
+      std::vector<char> *mContents;
+      std::size_t mPosition = (std::size_t)0;
+   };
+
+   void verifyState(char const *caller);
+
+  private:
+   std::shared_ptr<std::vector<char>> mContents;
+   ContentsBuffer mContentsBuffer;
+   std::ostream mContentsStream;
+};
+
+} /* namespace PV */
+
+#endif // STAGEDFILESTREAM_HPP_
@@ -70,6 +70,8 @@ class ANNLayer : public HyPerLayer {
 
    virtual bool activityIsSpiking() override { return false; }
 
+   virtual bool updatesWithoutMPI() const override { return true; }
+
   protected:
    ANNLayer();
    int initialize(const char *name, HyPerCol *hc);
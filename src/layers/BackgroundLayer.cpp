@@ -49,6 +49,7 @@ BackgroundLayer::communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage
       MPI_Barrier(parent->getCommunicator()->globalCommunicator());
       exit(EXIT_FAILURE);
    }
+   addUpdateDependency(originalLayer);
    const PVLayerLoc *srcLoc = originalLayer->getLayerLoc();
    const PVLayerLoc *loc    = getLayerLoc();
    assert(srcLoc != NULL && loc != NULL);
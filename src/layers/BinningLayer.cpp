@@ -102,9 +102,11 @@ BinningLayer::communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage con
       MPI_Barrier(parent->getCommunicator()->communicator());
       exit(EXIT_FAILURE);
    }
+   addUpdateDependency(mOriginalLayer);
    if (mOriginalLayer->getInitInfoCommunicatedFlag() == false) {
       return Response::POSTPONE;
    }
+   mOriginalLayer->checkZeroCopyReader(getDescription_c(), getPhase());
    mOriginalLayer->synchronizeMarginWidth(this);
    this->synchronizeMarginWidth(mOriginalLayer);
    const PVLayerLoc *srcLoc = mOriginalLayer->getLayerLoc();
@@ -65,6 +65,7 @@ CloneVLayer::communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage cons
       MPI_Barrier(parent->getCommunicator()->communicator());
       exit(EXIT_FAILURE);
    }
+   addUpdateDependency(originalLayer);
    const PVLayerLoc *srcLoc = originalLayer->getLayerLoc();
    const PVLayerLoc *loc    = getLayerLoc();
    assert(srcLoc != NULL && loc != NULL);
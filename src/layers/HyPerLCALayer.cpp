@@ -6,6 +6,7 @@
  */
 
 #include "HyPerLCALayer.hpp"
+#include "layers/fused_lca_kernels.hpp"
 #include <iostream>
 
 #ifdef PV_USE_CUDA
@@ -14,28 +15,6 @@
 
 #endif
 
-void HyPerLCALayer_update_state(
-      const int nbatch,
-      const int numNeurons,
-      const int nx,
-      const int ny,
-      const int nf,
-      const int lt,
-      const int rt,
-      const int dn,
-      const int up,
-      const int numChannels,
-      float *V,
-      int numVertices,
-      float *verticesV,
-      float *verticesA,
-      float *slopes,
-      const bool selfInteract,
-      double *dtAdapt,
-      const float tau,
-      float *GSynHead,
-      float *activity);
-
 namespace PV {
 
 HyPerLCALayer::HyPerLCALayer() { initialize_base(); }
@@ -234,42 +213,32 @@ Response::Status HyPerLCALayer::updateStateGpu(double time, double dt) {
 double HyPerLCALayer::getDeltaUpdateTime() { return parent->getDeltaTime(); }
 
 Response::Status HyPerLCALayer::updateState(double time, double dt) {
-   const PVLayerLoc *loc = getLayerLoc();
-   float *A              = clayer->activity->data;
-   float *V              = getV();
-   int num_channels      = getNumChannels();
-   float *gSynHead       = GSyn == NULL ? NULL : GSyn[0];
-   {
-      int nx          = loc->nx;
-      int ny          = loc->ny;
-      int nf          = loc->nf;
-      int num_neurons = nx * ny * nf;
-      int nbatch      = loc->nbatch;
-      // Only update when the probe updates
-
-      HyPerLCALayer_update_state(
-            nbatch,
-            num_neurons,
-            nx,
-            ny,
-            nf,
-            loc->halo.lt,
-            loc->halo.rt,
-            loc->halo.dn,
-            loc->halo.up,
-            numChannels,
-            V,
-            numVertices,
-            verticesV,
-            verticesA,
-            slopes,
-            selfInteract,
-            deltaTimes(),
-            timeConstantTau / (float)dt,
-            gSynHead,
-            A);
+   FusedLCAArgs args;
+   args.rule          = FUSED_LCA_HYPERLCA;
+   args.loc           = getLayerLoc();
+   args.numChannels   = numChannels;
+   args.V             = getV();
+   args.GSynHead      = GSyn[0];
+   args.activity      = clayer->activity->data;
+   args.prevDrive     = nullptr;
+   args.numVertices   = numVertices;
+   args.verticesV     = verticesV;
+   args.verticesA     = verticesA;
+   args.slopes        = slopes;
+   args.dtAdapt       = deltaTimes();
+   args.tau           = timeConstantTau / (float)dt;
+   args.selfInteract  = selfInteract ? 1.0f : 0.0f;
+   args.momentumRate  = 0.0f;
+   args.VThresh       = VThresh;
+   args.activeIndices = nullptr;
+   args.numActive     = nullptr;
+   if (getSparseFlag()) {
+      allocateRestrictedActiveIndices();
+      args.activeIndices = mRestrictedActiveIndices.data();
+      args.numActive     = mNumRestrictedActive.data();
    }
-
+   fusedLCAUpdate(args);
+   mRestrictedActiveIndicesFound = getSparseFlag();
    return Response::SUCCESS;
 }
 
@@ -284,48 +253,3 @@ double *HyPerLCALayer::deltaTimes() {
 }
 
 } /* namespace PV */
-
-void HyPerLCALayer_update_state(
-      const int nbatch,
-      const int numNeurons,
-      const int nx,
-      const int ny,
-      const int nf,
-      const int lt,
-      const int rt,
-      const int dn,
-      const int up,
-      const int numChannels,
-
-      float *V,
-      int numVertices,
-      float *verticesV,
-      float *verticesA,
-      float *slopes,
-      const bool selfInteract,
-      double *dtAdapt,
-      const float tau,
-      float *GSynHead,
-      float *activity) {
-   updateV_HyPerLCALayer(
-         nbatch,
-         numNeurons,
-         numChannels,
-         V,
-         GSynHead,
-         activity,
-         numVertices,
-         verticesV,
-         verticesA,
-         slopes,
-         dtAdapt,
-         tau,
-         selfInteract,
-         nx,
-         ny,
-         nf,
-         lt,
-         rt,
-         dn,
-         up);
-}
@@ -21,6 +21,7 @@
 #include "include/pv_common.h"
 #include "io/FileStream.hpp"
 #include "io/io.hpp"
+#include <algorithm>
 #include <assert.h>
 #include <iostream>
 #include <sstream>
@@ -486,7 +487,16 @@ void HyPerLayer::allocateGSyn() {
 
 void HyPerLayer::addPublisher() {
    MPIBlock const *mpiBlock = parent->getCommunicator()->getLocalMPIBlock();
-   publisher = new Publisher(*mpiBlock, clayer->activity, getNumDelayLevels(), getSparseFlag());
+   // The data store can share the activity buffer only if it needs no levels for delays.
+   bool shareActivity = mZeroCopyPublish and getNumDelayLevels() == 1;
+   if (mZeroCopyPublish and !shareActivity and parent->getCommunicator()->globalCommRank() == 0) {
+      WarnLog().printf(
+            "%s has zeroCopyPublish set, but a connection reads it with a delay. "
+            "The activity will be copied when published.\n",
+            getDescription_c());
+   }
+   publisher = new Publisher(
+         *mpiBlock, clayer->activity, getNumDelayLevels(), getSparseFlag(), shareActivity);
 }
 
 void HyPerLayer::checkpointPvpActivityFloat(
@@ -588,6 +598,7 @@ int HyPerLayer::ioParamsFillGroup(enum ParamsIOFlag ioFlag) {
    ioParam_initialWriteTime(ioFlag);
    ioParam_sparseLayer(ioFlag);
    ioParam_writeSparseValues(ioFlag);
+   ioParam_zeroCopyPublish(ioFlag);
 
    // GPU-specific parameter.  If not using GPUs, this flag
    // can be set to false or left out, but it is an error
@@ -875,58 +886,26 @@ void HyPerLayer::ioParam_writeSparseValues(enum ParamsIOFlag ioFlag) {
    }
 }
 
-Response::Status HyPerLayer::respond(std::shared_ptr<BaseMessage const> message) {
-   Response::Status status = BaseLayer::respond(message);
-   if (status != Response::SUCCESS) {
-      return status;
-   }
-   else if (auto castMessage = std::dynamic_pointer_cast<LayerSetMaxPhaseMessage const>(message)) {
-      return respondLayerSetMaxPhase(castMessage);
-   }
-   else if (auto castMessage = std::dynamic_pointer_cast<LayerWriteParamsMessage const>(message)) {
-      return respondLayerWriteParams(castMessage);
-   }
-   else if (
-         auto castMessage =
-               std::dynamic_pointer_cast<LayerProbeWriteParamsMessage const>(message)) {
-      return respondLayerProbeWriteParams(castMessage);
-   }
-   else if (
-         auto castMessage =
-               std::dynamic_pointer_cast<LayerClearProgressFlagsMessage const>(message)) {
-      return respondLayerClearProgressFlags(castMessage);
-   }
-   else if (auto castMessage = std::dynamic_pointer_cast<LayerUpdateStateMessage const>(message)) {
-      return respondLayerUpdateState(castMessage);
-   }
-   else if (
-         auto castMessage =
-               std::dynamic_pointer_cast<LayerRecvSynapticInputMessage const>(message)) {
-      return respondLayerRecvSynapticInput(castMessage);
-   }
+void HyPerLayer::ioParam_zeroCopyPublish(enum ParamsIOFlag ioFlag) {
+   parent->parameters()->ioParamValue(
+         ioFlag, name, "zeroCopyPublish", &mZeroCopyPublish, mZeroCopyPublish);
+}
+
+void HyPerLayer::initMessageActionMap() {
+   BaseLayer::initMessageActionMap();
+   setMessageAction(&HyPerLayer::respondLayerSetMaxPhase);
+   setMessageAction(&HyPerLayer::respondLayerWriteParams);
+   setMessageAction(&HyPerLayer::respondLayerProbeWriteParams);
+   setMessageAction(&HyPerLayer::respondLayerClearProgressFlags);
+   setMessageAction(&HyPerLayer::respondLayerUpdateState);
+   setMessageAction(&HyPerLayer::respondLayerRecvSynapticInput);
 #ifdef PV_USE_CUDA
-   else if (auto castMessage = std::dynamic_pointer_cast<LayerCopyFromGpuMessage const>(message)) {
-      return respondLayerCopyFromGpu(castMessage);
-   }
+   setMessageAction(&HyPerLayer::respondLayerCopyFromGpu);
 #endif // PV_USE_CUDA
-   else if (
-         auto castMessage =
-               std::dynamic_pointer_cast<LayerAdvanceDataStoreMessage const>(message)) {
-      return respondLayerAdvanceDataStore(castMessage);
-   }
-   else if (auto castMessage = std::dynamic_pointer_cast<LayerPublishMessage const>(message)) {
-      return respondLayerPublish(castMessage);
-   }
-   else if (auto castMessage = std::dynamic_pointer_cast<LayerOutputStateMessage const>(message)) {
-      return respondLayerOutputState(castMessage);
-   }
-   else if (
-         auto castMessage = std::dynamic_pointer_cast<LayerCheckNotANumberMessage const>(message)) {
-      return respondLayerCheckNotANumber(castMessage);
-   }
-   else {
-      return status;
-   }
+   setMessageAction(&HyPerLayer::respondLayerAdvanceDataStore);
+   setMessageAction(&HyPerLayer::respondLayerPublish);
+   setMessageAction(&HyPerLayer::respondLayerOutputState);
+   setMessageAction(&HyPerLayer::respondLayerCheckNotANumber);
 }
 
 Response::Status
@@ -1209,7 +1188,9 @@ HyPerLayer::communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage const
                      triggerLoc->nf);
             }
          }
+         addUpdateDependency(triggerResetLayer);
       }
+      addUpdateDependency(triggerLayer);
    }
 
 #ifdef PV_USE_CUDA
@@ -1300,6 +1281,15 @@ void HyPerLayer::synchronizeMarginWidth(HyPerLayer *layer) {
    return;
 }
 
+void HyPerLayer::addUpdateDependency(HyPerLayer *layer) {
+   pvAssert(layer != nullptr);
+   if (layer != this
+       and std::find(mUpdateDependencies.begin(), mUpdateDependencies.end(), layer)
+                 == mUpdateDependencies.end()) {
+      mUpdateDependencies.push_back(layer);
+   }
+}
+
 int HyPerLayer::equalizeMargins(HyPerLayer *layer1, HyPerLayer *layer2) {
    int border1, border2, maxborder, result;
    int status = PV_SUCCESS;
@@ -1485,6 +1475,21 @@ int HyPerLayer::increaseDelayLevels(int neededDelay) {
    return numDelayLevels;
 }
 
+void HyPerLayer::checkZeroCopyReader(char const *readerDescription, int readerPhase) {
+   if (!mZeroCopyPublish or readerPhase != getPhase()) {
+      return;
+   }
+   if (parent->getCommunicator()->globalCommRank() == 0) {
+      ErrorLog().printf(
+            "%s has zeroCopyPublish set, but %s, which reads its data store, is in the same "
+            "phase.\n",
+            getDescription_c(),
+            readerDescription);
+   }
+   MPI_Barrier(parent->getCommunicator()->globalCommunicator());
+   exit(EXIT_FAILURE);
+}
+
 int HyPerLayer::requireMarginWidth(int marginWidthNeeded, int *marginWidthResult, char axis) {
    // TODO: Is there a good way to handle x- and y-axis margins without so much duplication of code?
    // Navigating through the halo makes it difficult to combine cases.
@@ -1736,11 +1741,16 @@ bool HyPerLayer::needReset(double simTime, double dt) {
 Response::Status HyPerLayer::callUpdateState(double simTime, double dt) {
    auto status = Response::NO_ACTION;
    if (needUpdate(simTime, dt)) {
+      if (publisher->isSharingCubeData()) {
+         // The activity buffer is the data store, so the border exchange from the previous
+         // publish must complete before the activity changes, including by a reset.
+         publisher->wait();
+      }
+
       if (needReset(simTime, dt)) {
          resetStateOnTrigger();
          mLastTriggerTime = simTime;
       }
-
       update_timer->start();
 #ifdef PV_USE_CUDA
       if (mUpdateGpu) {
@@ -1928,6 +1938,43 @@ bool HyPerLayer::isAllInputReady() {
    return isReady;
 }
 
+void HyPerLayer::waitForAllInput() {
+   for (auto &c : recvConns) {
+      HyPerLayer *preLayer = c->getPre();
+      for (int delay = 0; delay < preLayer->getNumDelayLevels(); delay++) {
+         preLayer->getPublisher()->wait(delay);
+      }
+   }
+   if (publisher->isSharingCubeData()) {
+      publisher->wait();
+   }
+}
+
+Response::Status
+HyPerLayer::recvAndUpdateState(double simTime, double deltaTime, Timer *recvTimer) {
+   receiveInput(simTime, deltaTime, recvTimer);
+   return updateStateFromInput(simTime, deltaTime);
+}
+
+void HyPerLayer::receiveInput(double simTime, double deltaTime, Timer *recvTimer) {
+   resetGSynBuffers(simTime, deltaTime);
+
+   if (recvTimer) {
+      recvTimer->start();
+   }
+   recvAllSynapticInput();
+   mHasReceived = true;
+   if (recvTimer) {
+      recvTimer->stop();
+   }
+}
+
+Response::Status HyPerLayer::updateStateFromInput(double simTime, double deltaTime) {
+   auto status = callUpdateState(simTime, deltaTime);
+   mHasUpdated = true;
+   return status;
+}
+
 int HyPerLayer::recvAllSynapticInput() {
    int status = PV_SUCCESS;
    // Only recvAllSynapticInput if we need an update
@@ -2032,8 +2079,18 @@ int HyPerLayer::publish(Communicator *comm, double simTime) {
       if (useMirrorBCs()) {
          mirrorInteriorToBorder(clayer->activity, clayer->activity);
       }
-      status         = publisher->publish(mLastUpdateTime);
-      mNeedToPublish = false;
+      if (getSparseFlag()) {
+         if (!mRestrictedActiveIndicesFound) {
+            findRestrictedActiveIndices();
+         }
+         status = publisher->publish(
+               mLastUpdateTime, mRestrictedActiveIndices.data(), mNumRestrictedActive.data());
+      }
+      else {
+         status = publisher->publish(mLastUpdateTime);
+      }
+      mNeedToPublish                = false;
+      mRestrictedActiveIndicesFound = false;
    }
    else {
       publisher->copyForward(mLastUpdateTime);
@@ -2042,6 +2099,31 @@ int HyPerLayer::publish(Communicator *comm, double simTime) {
    return status;
 }
 
+void HyPerLayer::findRestrictedActiveIndices() {
+   PVLayerLoc const *loc = getLayerLoc();
+   PVHalo const *halo    = &loc->halo;
+   int const numNeurons  = getNumNeurons();
+   int const numExtended = getNumExtended();
+   int const rowStride   = (loc->nx + halo->lt + halo->rt) * loc->nf;
+   int const firstIndex  = halo->up * rowStride + halo->lt * loc->nf;
+
+   allocateRestrictedActiveIndices();
+   for (int b = 0; b < loc->nbatch; b++) {
+      mNumRestrictedActive[b] = DataStore::compactActiveIndices(
+            clayer->activity->data + b * numExtended,
+            loc->ny,
+            loc->nx * loc->nf,
+            rowStride,
+            firstIndex,
+            &mRestrictedActiveIndices[b * numNeurons]);
+   }
+}
+
+void HyPerLayer::allocateRestrictedActiveIndices() {
+   mRestrictedActiveIndices.resize(getLayerLoc()->nbatch * getNumNeurons());
+   mNumRestrictedActive.resize(getLayerLoc()->nbatch);
+}
+
 int HyPerLayer::waitOnPublish(Communicator *comm) {
    publish_timer->start();
 
@@ -198,6 +198,17 @@ class HyPerLayer : public BaseLayer {
     * @brief writeSparseValues: No longer used.
     */
    virtual void ioParam_writeSparseValues(enum ParamsIOFlag ioFlag); // obsolete March 14, 2017.
+
+   /**
+    * @brief zeroCopyPublish: If true, and no connection reads the layer's activity with a delay,
+    * the layer's activity buffer is also the publisher's data store, so that publishing does not
+    * copy the activity. Since the activity is then visible to other layers as soon as it is
+    * updated, nothing that reads the layer's data store may be in the same phase: neither a
+    * layer that a connection from this layer delivers to, nor a BinningLayer or ShuffleLayer
+    * whose original layer is this one.
+    * Default is false.
+    */
+   virtual void ioParam_zeroCopyPublish(enum ParamsIOFlag ioFlag);
    /** @} */
 
   private:
@@ -304,13 +315,6 @@ class HyPerLayer : public BaseLayer {
     */
    int freeExtendedBuffer(float **buf);
 
-   /**
-    * Returns true if each layer that delivers input to this layer
-    * has finished its MPI exchange for its delay; false if any of
-    * them has not.
-    */
-   bool isAllInputReady();
-
   public:
    HyPerLayer(const char *name, HyPerCol *hc);
    float *getActivity() {
@@ -319,9 +323,60 @@ class HyPerLayer : public BaseLayer {
    virtual double getTimeScale(int batchIdx) { return -1.0; };
    virtual bool activityIsSpiking() { return false; }
    PVDataType getDataType() { return dataType; }
-   virtual Response::Status respond(std::shared_ptr<BaseMessage const> message) override;
+
+   /**
+    * Returns true if each layer that delivers input to this layer
+    * has finished its MPI exchange for its delay; false if any of
+    * them has not.
+    */
+   bool isAllInputReady();
+
+   /**
+    * Waits, on the calling thread, for the MPI exchanges of each layer that delivers input to
+    * this layer, at all delay levels, and for the layer's own exchange if its activity buffer
+    * is shared with its data store. After this, delivering the input makes no MPI calls;
+    * whether updating the state does depends on the layer type (see updatesWithoutMPI()).
+    */
+   void waitForAllInput();
+
+   /**
+    * Returns true if, once waitForAllInput() has returned, receiving the input and updating the
+    * state make no MPI calls, so that HyPerCol can update the layer on a thread other than the main one.
+    * The default is false. Layer types whose updateState() has been checked for MPI calls,
+    * including calls made through probes, override it.
+    */
+   virtual bool updatesWithoutMPI() const { return false; }
+
+   /**
+    * Receives the synaptic input and then updates the state of the layer, without checking
+    * whether the input is ready. If recvTimer is not null, it times the receive step.
+    * Called by HyPerCol's layer update schedule once the layer's input is ready and any layers
+    * it depends on in the same phase have updated.
+    */
+   Response::Status recvAndUpdateState(double simTime, double deltaTime, Timer *recvTimer);
+
+   /**
+    * The receive step of recvAndUpdateState(). HyPerCol calls this and then
+    * updateStateFromInput() in separate passes over the layers it updates concurrently, so that
+    * its receive timer measures only the receives.
+    */
+   void receiveInput(double simTime, double deltaTime, Timer *recvTimer);
+
+   /**
+    * The update step of recvAndUpdateState(), called after receiveInput().
+    */
+   Response::Status updateStateFromInput(double simTime, double deltaTime);
+
+   /**
+    * Returns the other layers that this layer reads directly when it updates, for example its
+    * original layer or its trigger layer. The layer update schedule does not update a layer
+    * concurrently with any of these layers.
+    */
+   std::vector<HyPerLayer *> const &getUpdateDependencies() const { return mUpdateDependencies; }
 
   protected:
+   virtual void initMessageActionMap() override;
+
    /**
     * The function that calls all ioParam functions
     */
@@ -329,6 +384,13 @@ class HyPerLayer : public BaseLayer {
 
    static int equalizeMargins(HyPerLayer *layer1, HyPerLayer *layer2);
 
+   /**
+    * Records that the layer reads the given layer directly when it updates.
+    * Derived classes that refer to another layer should call this method during
+    * communicateInitInfo. See getUpdateDependencies().
+    */
+   void addUpdateDependency(HyPerLayer *layer);
+
    int freeClayer();
 
   public:
@@ -462,6 +524,16 @@ class HyPerLayer : public BaseLayer {
    int getNumDelayLevels() { return numDelayLevels; }
 
    int increaseDelayLevels(int neededDelay);
+
+   /**
+    * Exits with an error if this layer has zeroCopyPublish set and an object that reads its data
+    * store is in the same phase. Such a reader would see the activity of the current timestep
+    * while the layer is still updating it. Called during the CommunicateInitInfo stage by each
+    * object that reads another layer's data store: the connections' delivery components,
+    * BinningLayer and ShuffleLayer.
+    */
+   void checkZeroCopyReader(char const *readerDescription, int readerPhase);
+
    virtual int requireMarginWidth(int marginWidthNeeded, int *marginWidthResult, char axis);
    virtual int requireChannel(int channelNeeded, int *numChannelsResult);
 
@@ -479,6 +551,7 @@ class HyPerLayer : public BaseLayer {
    float getValueBC() { return this->valueBC; }
 
    bool getSparseFlag() { return this->sparseLayer; }
+   bool getZeroCopyPublish() const { return mZeroCopyPublish; }
 
    int getPhase() { return this->phase; }
 
@@ -512,8 +585,28 @@ class HyPerLayer : public BaseLayer {
    virtual int setActivity();
    void freeChannels();
 
+   /**
+    * For sparse layers, finds the active neurons of the restricted region of each batch
+    * element, in parallel, for the publisher to pass to the data store.
+    */
+   void findRestrictedActiveIndices();
+
+   /**
+    * Sizes mRestrictedActiveIndices and mNumRestrictedActive for the layer's batch.
+    * An updateState() that finds the active neurons while it sets the activity calls this
+    * method, fills the buffers, and sets mRestrictedActiveIndicesFound, so that the next
+    * publish() does not search the activity buffer again.
+    */
+   void allocateRestrictedActiveIndices();
+
    bool mNeedToPublish = true;
 
+   // The active neurons of the restricted region found by findRestrictedActiveIndices(),
+   // with extended indices. Batch element b begins at mRestrictedActiveIndices[b * numNeurons].
+   std::vector<SparseList<float>::Entry> mRestrictedActiveIndices;
+   std::vector<long> mNumRestrictedActive;
+   bool mRestrictedActiveIndicesFound = false;
+
    int numChannels; // number of channels
    float **GSyn; // of dynamic length numChannels
    Publisher *publisher = nullptr;
@@ -544,6 +637,7 @@ class HyPerLayer : public BaseLayer {
    CheckpointableFileStream *mOutputStateStream = nullptr; // activity generated by outputState
 
    bool sparseLayer; // if true, only nonzero activities are saved; if false, all values are saved.
+   bool mZeroCopyPublish = false;
    // bool writeSparseValues; // removed March 14, 2017
    int writeActivityCalls; // Number of calls to writeActivity (written to nbands in the header of
    // the a%d.pvp file)
@@ -594,6 +688,8 @@ class HyPerLayer : public BaseLayer {
    bool mHasReceived = false;
    bool mHasUpdated  = false;
 
+   std::vector<HyPerLayer *> mUpdateDependencies;
+
 // GPU variables
 #ifdef PV_USE_CUDA
   public:
@@ -6,6 +6,7 @@
  */
 
 #include "ISTALayer.hpp"
+#include "layers/fused_lca_kernels.hpp"
 #include <iostream>
 
 #ifdef PV_USE_CUDA
@@ -14,25 +15,6 @@
 
 #endif
 
-void ISTALayer_update_state(
-      const int nbatch,
-      const int numNeurons,
-      const int nx,
-      const int ny,
-      const int nf,
-      const int lt,
-      const int rt,
-      const int dn,
-      const int up,
-      const int numChannels,
-
-      float *V,
-      const float Vth,
-      double *dtAdapt,
-      const float tau,
-      float *GSynHead,
-      float *activity);
-
 namespace PV {
 
 ISTALayer::ISTALayer() { initialize_base(); }
@@ -175,41 +157,39 @@ Response::Status ISTALayer::updateStateGpu(double time, double dt) {
 double ISTALayer::getDeltaUpdateTime() { return parent->getDeltaTime(); }
 
 Response::Status ISTALayer::updateState(double time, double dt) {
-   const PVLayerLoc *loc = getLayerLoc();
-   float *A              = clayer->activity->data;
-   float *V              = getV();
-   int num_channels      = getNumChannels();
-   float *gSynHead       = GSyn == NULL ? NULL : GSyn[0];
-   int nx                = loc->nx;
-   int ny                = loc->ny;
-   int nf                = loc->nf;
-   int num_neurons       = nx * ny * nf;
-   int nbatch            = loc->nbatch;
-   // Only update when the probe updates
-
    if (triggerLayer != NULL && triggerLayer->needUpdate(time, parent->getDeltaTime())) {
-      for (int i = 0; i < num_neurons * nbatch; i++) {
+      float *V = getV();
+      for (int i = 0; i < getNumNeurons() * getLayerLoc()->nbatch; i++) {
          V[i] = 0.0;
       }
    }
 
-   ISTALayer_update_state(
-         nbatch,
-         num_neurons,
-         nx,
-         ny,
-         nf,
-         loc->halo.lt,
-         loc->halo.rt,
-         loc->halo.dn,
-         loc->halo.up,
-         numChannels,
-         V,
-         VThresh,
-         deltaTimes(),
-         timeConstantTau / (float)dt,
-         gSynHead,
-         A);
+   FusedLCAArgs args;
+   args.rule          = FUSED_LCA_ISTA;
+   args.loc           = getLayerLoc();
+   args.numChannels   = numChannels;
+   args.V             = getV();
+   args.GSynHead      = GSyn[0];
+   args.activity      = clayer->activity->data;
+   args.prevDrive     = nullptr;
+   args.numVertices   = numVertices;
+   args.verticesV     = verticesV;
+   args.verticesA     = verticesA;
+   args.slopes        = slopes;
+   args.dtAdapt       = deltaTimes();
+   args.tau           = timeConstantTau / (float)dt;
+   args.selfInteract  = 0.0f;
+   args.momentumRate  = 0.0f;
+   args.VThresh       = VThresh;
+   args.activeIndices = nullptr;
+   args.numActive     = nullptr;
+   if (getSparseFlag()) {
+      allocateRestrictedActiveIndices();
+      args.activeIndices = mRestrictedActiveIndices.data();
+      args.numActive     = mNumRestrictedActive.data();
+   }
+   fusedLCAUpdate(args);
+   mRestrictedActiveIndicesFound = getSparseFlag();
    return Response::SUCCESS;
 }
 
@@ -224,40 +204,3 @@ double *ISTALayer::deltaTimes() {
 }
 
 } /* namespace PV */
-
-void ISTALayer_update_state(
-      const int nbatch,
-      const int numNeurons,
-      const int nx,
-      const int ny,
-      const int nf,
-      const int lt,
-      const int rt,
-      const int dn,
-      const int up,
-      const int numChannels,
-
-      float *V,
-      const float Vth,
-      double *dtAdapt,
-      const float tau,
-      float *GSynHead,
-      float *activity) {
-   updateV_ISTALayer(
-         nbatch,
-         numNeurons,
-         V,
-         GSynHead,
-         activity,
-         Vth,
-         dtAdapt,
-         tau,
-         nx,
-         ny,
-         nf,
-         lt,
-         rt,
-         dn,
-         up,
-         numChannels);
-}
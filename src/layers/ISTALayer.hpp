@@ -21,6 +21,12 @@ class ISTALayer : public PV::ANNLayer {
    virtual double getDeltaUpdateTime() override;
    virtual int requireChannel(int channelNeeded, int *numChannelsResult) override;
 
+   /**
+    * The adaptive time scale probe, if there is one, is read during updateState() and may
+    * compute its values with MPI reductions.
+    */
+   virtual bool updatesWithoutMPI() const override { return mAdaptiveTimeScaleProbe == nullptr; }
+
   protected:
    ISTALayer();
    int initialize(const char *name, HyPerCol *hc);
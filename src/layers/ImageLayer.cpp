@@ -50,7 +50,7 @@ Response::Status ImageLayer::registerData(Checkpointer *checkpointer) {
 }
 
 void ImageLayer::populateFileList() {
-   if (getMPIBlock()->getRank() == 0) {
+   if (isInputLoader()) {
       std::string line;
       mFileList.clear();
       InfoLog() << "Reading list: " << getInputPath() << "\n";
@@ -82,35 +82,37 @@ Buffer<float> ImageLayer::retrieveData(int inputIndex) {
    else {
       filename = getInputPath();
    }
-   readImage(filename);
+   // Decode into a local Image, so that retrieveData can be called from several prefetch
+   // threads at once.
+   std::unique_ptr<Image> image = readImage(filename);
 
-   if (mImage->getFeatures() != getLayerLoc()->nf) {
+   if (image->getFeatures() != getLayerLoc()->nf) {
       switch (getLayerLoc()->nf) {
          case 1: // Grayscale
-            mImage->convertToGray(false);
+            image->convertToGray(false);
             break;
          case 2: // Grayscale + Alpha
-            mImage->convertToGray(true);
+            image->convertToGray(true);
             break;
          case 3: // RGB
-            mImage->convertToColor(false);
+            image->convertToColor(false);
             break;
          case 4: // RGBA
-            mImage->convertToColor(true);
+            image->convertToColor(true);
             break;
          default:
             Fatal() << "Failed to read " << filename << ": Could not convert "
-                    << mImage->getFeatures() << " channels to " << getLayerLoc()->nf << std::endl;
+                    << image->getFeatures() << " channels to " << getLayerLoc()->nf << std::endl;
             break;
       }
    }
 
    Buffer<float> result(
-         mImage->asVector(), mImage->getWidth(), mImage->getHeight(), getLayerLoc()->nf);
+         image->asVector(), image->getWidth(), image->getHeight(), getLayerLoc()->nf);
    return result;
 }
 
-void ImageLayer::readImage(std::string filename) {
+std::unique_ptr<Image> ImageLayer::readImage(std::string filename) {
    const PVLayerLoc *loc = getLayerLoc();
    bool usingTempFile    = false;
 
@@ -149,12 +151,13 @@ void ImageLayer::readImage(std::string filename) {
       }
    }
 
-   mImage = std::unique_ptr<Image>(new Image(std::string(filename)));
+   std::unique_ptr<Image> image(new Image(std::string(filename)));
 
    FatalIf(
          usingTempFile && remove(filename.c_str()),
          "remove(\"%s\") failed.  Exiting.\n",
          filename.c_str());
+   return image;
 }
 
 std::string ImageLayer::describeInput(int index) {
@@ -15,7 +15,7 @@ class ImageLayer : public InputLayer {
    void populateFileList();
    virtual Buffer<float> retrieveData(int inputIndex) override;
    virtual std::string describeInput(int index) override;
-   void readImage(std::string filename);
+   std::unique_ptr<Image> readImage(std::string filename);
 
   public:
    ImageLayer(const char *name, HyPerCol *hc);
@@ -24,8 +24,6 @@ class ImageLayer : public InputLayer {
    getCurrentFilename(int localBatchElement, int mpiBatchIndex) const override;
 
   protected:
-   std::unique_ptr<Image> mImage = nullptr;
-
    // Automatically set if the inputPath ends in .txt. Determines whether this layer represents a
    // collection of files.
    bool mUsingFileList = false;
@@ -113,18 +113,43 @@ void InputLayer::retrieveInput(double timef, double dt) {
       }
    }
 
+   // In distributed mode, the root process sends each batch element's input index and jitter
+   // to the processes that load them.
+   std::vector<int> blockIndices;
+   if (getMPIBlock()->getRank() == 0) {
+      blockIndices = getBlockInputIndices();
+   }
+   if (mDistributedInputLoading) {
+      broadcastBlockInputIndices(blockIndices);
+      broadcastJitter();
+   }
+
+   // If the prefetch threads loaded the inputs for the current indices, use them; otherwise
+   // (e.g. on the first display period), load each input below.
+   std::vector<Buffer<float>> prefetchedData;
+   bool usePrefetched = false;
+   if (mPrefetcher) {
+      usePrefetched = mPrefetcher->collect(getLoadedInputIndices(blockIndices), &prefetchedData);
+   }
+
    int localNBatch = getLayerLoc()->nbatch;
+   int loadOffset  = mDistributedInputLoading ? localNBatch * getMPIBlock()->getBatchIndex() : 0;
    for (int m = 0; m < getMPIBlock()->getBatchDimension(); m++) {
       for (int b = 0; b < localNBatch; b++) {
-         if (getMPIBlock()->getRank() == 0) {
+         if (getMPIBlock()->getRank() == getLoaderRank(m)) {
             int blockBatchElement = b + localNBatch * m;
-            int inputIndex        = mBatchIndexer->getIndex(blockBatchElement);
-            mInputData.at(b)      = retrieveData(inputIndex);
-            int width             = mInputData.at(b).getWidth();
-            int height            = mInputData.at(b).getHeight();
-            int features          = mInputData.at(b).getFeatures();
-            mInputRegion.at(b)    = Buffer<float>(width, height, features);
-            int const N           = mInputRegion.at(b).getTotalElements();
+            int inputIndex        = blockIndices.at(blockBatchElement);
+            if (usePrefetched) {
+               mInputData.at(b) = std::move(prefetchedData.at(blockBatchElement - loadOffset));
+            }
+            else {
+               mInputData.at(b) = retrieveData(inputIndex);
+            }
+            int width          = mInputData.at(b).getWidth();
+            int height         = mInputData.at(b).getHeight();
+            int features       = mInputData.at(b).getFeatures();
+            mInputRegion.at(b) = Buffer<float>(width, height, features);
+            int const N        = mInputRegion.at(b).getTotalElements();
             for (int k = 0; k < N; k++) {
                mInputRegion.at(b).set(k, 1.0f);
             }
@@ -154,11 +179,91 @@ void InputLayer::retrieveInputAndAdvanceIndex(double timef, double dt) {
          mBatchIndexer->nextIndex(b);
       }
    }
+   // Start loading the next display period's inputs while this one is simulated.
+   if (mNumPrefetchThreads > 0) {
+      std::vector<int> blockIndices;
+      if (getMPIBlock()->getRank() == 0) {
+         blockIndices = getBlockInputIndices();
+      }
+      if (mDistributedInputLoading) {
+         broadcastBlockInputIndices(blockIndices);
+      }
+      if (mPrefetcher) {
+         mPrefetcher->prefetch(getLoadedInputIndices(blockIndices));
+      }
+   }
+}
+
+std::vector<int> InputLayer::getBlockInputIndices() {
+   pvAssert(mBatchIndexer);
+   int blockBatchCount = getLayerLoc()->nbatch * getMPIBlock()->getBatchDimension();
+   std::vector<int> inputIndices(blockBatchCount);
+   for (int b = 0; b < blockBatchCount; b++) {
+      inputIndices[b] = mBatchIndexer->getIndex(b);
+   }
+   return inputIndices;
+}
+
+std::vector<int> InputLayer::getLoadedInputIndices(std::vector<int> const &blockIndices) {
+   if (!mDistributedInputLoading) {
+      return blockIndices;
+   }
+   int const localNBatch = getLayerLoc()->nbatch;
+   auto start            = blockIndices.begin() + localNBatch * getMPIBlock()->getBatchIndex();
+   return std::vector<int>(start, start + localNBatch);
+}
+
+void InputLayer::broadcastBlockInputIndices(std::vector<int> &blockIndices) {
+   int blockBatchCount = getLayerLoc()->nbatch * getMPIBlock()->getBatchDimension();
+   blockIndices.resize(blockBatchCount);
+   MPI_Bcast(blockIndices.data(), blockBatchCount, MPI_INT, 0, getMPIBlock()->getComm());
+}
+
+void InputLayer::broadcastJitter() {
+   int blockBatchCount = getLayerLoc()->nbatch * getMPIBlock()->getBatchDimension();
+   std::vector<int> jitter(4 * blockBatchCount);
+   if (getMPIBlock()->getRank() == 0) {
+      for (int b = 0; b < blockBatchCount; b++) {
+         jitter[4 * b + 0] = mRandomShiftX[b];
+         jitter[4 * b + 1] = mRandomShiftY[b];
+         jitter[4 * b + 2] = mMirrorFlipX[b] ? 1 : 0;
+         jitter[4 * b + 3] = mMirrorFlipY[b] ? 1 : 0;
+      }
+   }
+   MPI_Bcast(jitter.data(), 4 * blockBatchCount, MPI_INT, 0, getMPIBlock()->getComm());
+   if (isInputLoader()) {
+      for (int b = 0; b < blockBatchCount; b++) {
+         mRandomShiftX[b] = jitter[4 * b + 0];
+         mRandomShiftY[b] = jitter[4 * b + 1];
+         mMirrorFlipX[b]  = jitter[4 * b + 2] != 0;
+         mMirrorFlipY[b]  = jitter[4 * b + 3] != 0;
+      }
+   }
+}
+
+int InputLayer::getLoaderRank(int mpiBatchIndex) {
+   if (mDistributedInputLoading) {
+      return getMPIBlock()->calcRankFromRowColBatch(0, 0, mpiBatchIndex);
+   }
+   else {
+      return 0;
+   }
+}
+
+bool InputLayer::isInputLoader() {
+   if (mDistributedInputLoading) {
+      return getMPIBlock()->getRowIndex() == 0 and getMPIBlock()->getColumnIndex() == 0;
+   }
+   else {
+      return getMPIBlock()->getRank() == 0;
+   }
 }
 
 int InputLayer::scatterInput(int localBatchIndex, int mpiBatchIndex) {
-   int const procBatchIndex = getMPIBlock()->getBatchIndex();
-   if (procBatchIndex != 0 and procBatchIndex != mpiBatchIndex) {
+   int const procBatchIndex   = getMPIBlock()->getBatchIndex();
+   int const sourceRank       = getLoaderRank(mpiBatchIndex);
+   int const sourceBatchIndex = mDistributedInputLoading ? mpiBatchIndex : 0;
+   if (procBatchIndex != sourceBatchIndex and procBatchIndex != mpiBatchIndex) {
       return PV_SUCCESS;
    }
    PVLayerLoc const *loc = getLayerLoc();
@@ -179,7 +284,7 @@ int InputLayer::scatterInput(int localBatchIndex, int mpiBatchIndex) {
    Buffer<float> dataBuffer;
    Buffer<float> regionBuffer;
 
-   if (getMPIBlock()->getRank() == 0) {
+   if (getMPIBlock()->getRank() == sourceRank) {
       dataBuffer   = mInputData.at(localBatchIndex);
       regionBuffer = mInputRegion.at(localBatchIndex);
    }
@@ -187,8 +292,10 @@ int InputLayer::scatterInput(int localBatchIndex, int mpiBatchIndex) {
       dataBuffer.resize(activityWidth, activityHeight, loc->nf);
       regionBuffer.resize(activityWidth, activityHeight, loc->nf);
    }
-   BufferUtils::scatter<float>(getMPIBlock(), dataBuffer, loc->nx, loc->ny, mpiBatchIndex, 0);
-   BufferUtils::scatter<float>(getMPIBlock(), regionBuffer, loc->nx, loc->ny, mpiBatchIndex, 0);
+   BufferUtils::scatter<float>(
+         getMPIBlock(), dataBuffer, loc->nx, loc->ny, mpiBatchIndex, sourceRank);
+   BufferUtils::scatter<float>(
+         getMPIBlock(), regionBuffer, loc->nx, loc->ny, mpiBatchIndex, sourceRank);
    if (procBatchIndex != mpiBatchIndex) {
       return PV_SUCCESS;
    }
@@ -242,7 +349,7 @@ int InputLayer::scatterInput(int localBatchIndex, int mpiBatchIndex) {
 }
 
 void InputLayer::fitBufferToGlobalLayer(Buffer<float> &buffer, int blockBatchElement) {
-   pvAssert(getMPIBlock()->getRank() == 0);
+   pvAssert(isInputLoader());
    const PVLayerLoc *loc  = getLayerLoc();
    int const xMargins     = mUseInputBCflag ? loc->halo.lt + loc->halo.rt : 0;
    int const yMargins     = mUseInputBCflag ? loc->halo.dn + loc->halo.up : 0;
@@ -445,6 +552,8 @@ int InputLayer::ioParamsFillGroup(enum ParamsIOFlag ioFlag) {
    ioParam_skip_frame_index(ioFlag);
    ioParam_resetToStartOnLoop(ioFlag);
    ioParam_writeFrameToTimestamp(ioFlag);
+   ioParam_numPrefetchThreads(ioFlag);
+   ioParam_distributedInputLoading(ioFlag);
    return status;
 }
 
@@ -477,6 +586,22 @@ Response::Status InputLayer::registerData(Checkpointer *checkpointer) {
                timestampFilename, needToCreateFile, checkpointer, cpFileStreamLabel);
       }
    }
+   else if (isInputLoader()) {
+      // In distributed mode, the other loaders open the input themselves, and receive their
+      // indices and jitter from the root process, which keeps the BatchIndexer.
+      int nBatch = getMPIBlock()->getBatchDimension() * getLayerLoc()->nbatch;
+      mRandomShiftX.resize(nBatch);
+      mRandomShiftY.resize(nBatch);
+      mMirrorFlipX.resize(nBatch);
+      mMirrorFlipY.resize(nBatch);
+      mInputData.resize(getLayerLoc()->nbatch);
+      mInputRegion.resize(getLayerLoc()->nbatch);
+      countInputImages();
+   }
+   if (isInputLoader() and mNumPrefetchThreads > 0) {
+      mPrefetcher = std::unique_ptr<InputPrefetcher>(new InputPrefetcher(
+            mNumPrefetchThreads, [this](int inputIndex) { return retrieveData(inputIndex); }));
+   }
    return Response::SUCCESS;
 }
 
@@ -494,6 +619,12 @@ Response::Status InputLayer::readStateFromCheckpoint(Checkpointer *checkpointer)
    return status;
 }
 
+Response::Status InputLayer::cleanup() {
+   // Stop the prefetch threads while the subclass's retrieveData() can still be called.
+   mPrefetcher = nullptr;
+   return Response::SUCCESS;
+}
+
 int InputLayer::checkValidAnchorString(const char *offsetAnchor) {
    int status = PV_SUCCESS;
    if (offsetAnchor == NULL || strlen(offsetAnchor) != (size_t)2) {
@@ -884,4 +1015,29 @@ void InputLayer::ioParam_writeFrameToTimestamp(enum ParamsIOFlag ioFlag) {
    }
 }
 
+void InputLayer::ioParam_numPrefetchThreads(enum ParamsIOFlag ioFlag) {
+   assert(!parent->parameters()->presentAndNotBeenRead(name, "displayPeriod"));
+   if (mDisplayPeriod > 0) {
+      parent->parameters()->ioParamValue(
+            ioFlag, name, "numPrefetchThreads", &mNumPrefetchThreads, mNumPrefetchThreads);
+      FatalIf(
+            mNumPrefetchThreads < 0,
+            "%s: numPrefetchThreads cannot be negative (value is %d).\n",
+            getDescription_c(),
+            mNumPrefetchThreads);
+   }
+   else {
+      mNumPrefetchThreads = 0;
+   }
+}
+
+void InputLayer::ioParam_distributedInputLoading(enum ParamsIOFlag ioFlag) {
+   parent->parameters()->ioParamValue(
+         ioFlag,
+         name,
+         "distributedInputLoading",
+         &mDistributedInputLoading,
+         mDistributedInputLoading);
+}
+
 } // end namespace PV
@@ -8,6 +8,7 @@
 #include "checkpointing/CheckpointableFileStream.hpp"
 #include "columns/HyPerCol.hpp"
 #include "components/BatchIndexer.hpp"
+#include "components/InputPrefetcher.hpp"
 #include "structures/Buffer.hpp"
 #include "utils/BorderExchange.hpp"
 #include "utils/BufferUtilsRescale.hpp"
@@ -119,6 +120,18 @@ class InputLayer : public HyPerLayer {
    // useInputBCFlag: Specifies if the input should be scaled to fill margins
    virtual void ioParam_useInputBCflag(enum ParamsIOFlag ioFlag);
 
+   // numPrefetchThreads: If positive, the root process uses this many threads to load the
+   // inputs for the next display period while the current one is being simulated.
+   // Subclasses' retrieveData() must then be thread-safe. Read only if displayPeriod > 0.
+   virtual void ioParam_numPrefetchThreads(enum ParamsIOFlag ioFlag);
+
+   // distributedInputLoading: If false (the default), the root process of the MPIBlock loads
+   // the inputs for every batch element in the block, and scatters them to the other processes.
+   // If true, for each batch index in the MPIBlock, the process in row zero and column zero
+   // loads that batch index's inputs itself, and scatters them only to the processes with the
+   // same batch index. All these processes must be able to read the input files.
+   virtual void ioParam_distributedInputLoading(enum ParamsIOFlag ioFlag);
+
   protected:
    InputLayer() {}
 
@@ -129,6 +142,18 @@ class InputLayer : public HyPerLayer {
    int scatterInput(int localBatchIndex, int mpiBatchIndex);
    int initialize(const char *name, HyPerCol *hc);
 
+   /**
+    * Returns the rank, within the MPIBlock, of the process that loads the inputs for the
+    * given MPI batch index. This is rank zero unless distributedInputLoading is set.
+    */
+   int getLoaderRank(int mpiBatchIndex);
+
+   /**
+    * Returns true if this process loads inputs, i.e. calls countInputImages() and
+    * retrieveData(). This is only the root process unless distributedInputLoading is set.
+    */
+   bool isInputLoader();
+
    // Returns PV_SUCCESS if offsetAnchor is a valid anchor string, PV_FAILURE otherwise.
    // (two characters long; first characters one of 't', 'c', or 'b'; second characters one of 'l',
    // 'c', or 'r')
@@ -147,6 +172,7 @@ class InputLayer : public HyPerLayer {
    virtual int ioParamsFillGroup(enum ParamsIOFlag ioFlag) override;
    virtual Response::Status registerData(Checkpointer *checkpointer) override;
    virtual Response::Status readStateFromCheckpoint(Checkpointer *checkpointer) override;
+   virtual Response::Status cleanup() override;
    virtual double getDeltaUpdateTime() override;
 
    // Method that signals when to load the next file.
@@ -155,15 +181,20 @@ class InputLayer : public HyPerLayer {
 
    /**
     * This pure virtual function gets called by initializeBatchIndexer in order
-    * to give the BatchIndexer the number of input images.
+    * to give the BatchIndexer the number of input images. If distributedInputLoading
+    * is set, it is also called by the other processes that load inputs, so that they
+    * can open the input.
     */
    virtual int countInputImages() = 0;
 
    /**
-    * This pure virtual function gets called by the root process during
+    * This pure virtual function gets called by the root process (or, if
+    * distributedInputLoading is set, by each process that loads inputs) during
     * initializeActivity and during updateState. It loads the entire input
     * (scattering to nonroot processes is done by the scatterInput method)
     * into a buffer. inputIndex is the (zero-indexed) index into the list of inputs.
+    * If numPrefetchThreads is positive, it is also called from the prefetch threads,
+    * possibly several at a time.
     */
    virtual Buffer<float> retrieveData(int inputIndex) = 0;
 
@@ -220,10 +251,35 @@ class InputLayer : public HyPerLayer {
    float *getInputRegionsAllBatchElements() { return mInputRegionsAllBatchElements.data(); }
 
   private:
+   /**
+    * Returns the current input index of each batch element of the MPIBlock.
+    * This method is called only by the root process.
+    */
+   std::vector<int> getBlockInputIndices();
+
+   /**
+    * Returns the part of blockIndices that this process loads: all of it, unless
+    * distributedInputLoading is set, in which case only the elements with this process's
+    * MPI batch index.
+    */
+   std::vector<int> getLoadedInputIndices(std::vector<int> const &blockIndices);
+
+   /**
+    * Copies the root process's block input indices into blockIndices on every process in the
+    * MPIBlock. Used when distributedInputLoading is set.
+    */
+   void broadcastBlockInputIndices(std::vector<int> &blockIndices);
+
+   /**
+    * Copies the root process's random shifts and flips to every process that loads inputs.
+    * Used when distributedInputLoading is set.
+    */
+   void broadcastJitter();
+
    /**
     * Resizes a buffer from the image size to the global layer size. If autoResizeFlag is true,
     * it calls BufferUtils::rescale. If autoResizeFlag is false, it calls Buffer methods grow,
-    * translate, and crop. This method is called only by the root process.
+    * translate, and crop. This method is called only by the processes that load inputs.
     */
    void fitBufferToGlobalLayer(Buffer<float> &buffer, int blockBatchElement);
 
@@ -324,6 +380,16 @@ class InputLayer : public HyPerLayer {
    // Flag to write filenames and batch indices to disk as they are loaded
    bool mWriteFrameToTimestamp = true;
 
+   // Number of threads loading the next display period's inputs. Zero disables prefetching.
+   int mNumPrefetchThreads = 0;
+
+   // Loads the next display period's inputs in the background. Only created on processes that
+   // load inputs.
+   std::unique_ptr<InputPrefetcher> mPrefetcher;
+
+   // If true, each MPI batch index of the MPIBlock loads its own inputs.
+   bool mDistributedInputLoading = false;
+
    // An array of starting file list indices, one per batch
    std::vector<int> mStartFrameIndex;
 
@@ -103,6 +103,7 @@ InputRegionLayer::communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage
    }
    setOriginalLayer(message->lookup<HyPerLayer>(std::string(originalLayerName)));
    pvAssert(originalLayer);
+   addUpdateDependency(originalLayer);
    if (!originalLayer->getInitInfoCommunicatedFlag()) {
       return Response::POSTPONE; // Make sure original layer has all the information we need to copy
    }
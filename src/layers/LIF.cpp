@@ -22,6 +22,14 @@
 #include <cstring>
 #include <memory>
 
+void LIF_add_noise(
+      const int numNeuronsAllBatches,
+      const float dt,
+      LIF_params const *params,
+      taus_uint4 *rnd,
+      float const *GSynHead,
+      float *noisyGSynHead);
+
 void LIF_update_state_arma(
       const int nbatch,
       const int numNeurons,
@@ -37,7 +45,7 @@ void LIF_update_state_arma(
       const int up,
 
       LIF_params *params,
-      taus_uint4 *rnd,
+      float const *noisyGSynHead,
 
       float *V,
       float *Vth,
@@ -62,7 +70,7 @@ void LIF_update_state_beginning(
       const int up,
 
       LIF_params *params,
-      taus_uint4 *rnd,
+      float const *noisyGSynHead,
 
       float *V,
       float *Vth,
@@ -87,7 +95,7 @@ void LIF_update_state_original(
       const int up,
 
       LIF_params *params,
-      taus_uint4 *rnd,
+      float const *noisyGSynHead,
 
       float *V,
       float *Vth,
@@ -321,6 +329,7 @@ Response::Status LIF::allocateDataStructures() {
 
 void LIF::allocateBuffers() {
    allocateConductances(numChannels);
+   mNoisyGSyn.resize((std::size_t)(3 * getNumNeuronsAllBatches()));
    Vth = (float *)calloc((size_t)getNumNeuronsAllBatches(), sizeof(float));
    if (Vth == NULL) {
       Fatal().printf(
@@ -412,6 +421,8 @@ Response::Status LIF::updateState(double time, double dt) {
    float *GSynHead = GSyn[0];
    float *activity = clayer->activity->data;
 
+   addNoise(dt);
+
    switch (method) {
       case 'a':
          LIF_update_state_arma(
@@ -427,7 +438,7 @@ Response::Status LIF::updateState(double time, double dt) {
                halo->dn,
                halo->up,
                &lParams,
-               randState->getRNG(0),
+               mNoisyGSyn.data(),
                clayer->V,
                Vth,
                G_E,
@@ -450,7 +461,7 @@ Response::Status LIF::updateState(double time, double dt) {
                halo->dn,
                halo->up,
                &lParams,
-               randState->getRNG(0),
+               mNoisyGSyn.data(),
                clayer->V,
                Vth,
                G_E,
@@ -473,7 +484,7 @@ Response::Status LIF::updateState(double time, double dt) {
                halo->dn,
                halo->up,
                &lParams,
-               randState->getRNG(0),
+               mNoisyGSyn.data(),
                clayer->V,
                Vth,
                G_E,
@@ -488,6 +499,16 @@ Response::Status LIF::updateState(double time, double dt) {
    return Response::SUCCESS;
 }
 
+void LIF::addNoise(double dt) {
+   LIF_add_noise(
+         getNumNeuronsAllBatches(),
+         (float)dt,
+         &lParams,
+         randState->getRNG(0),
+         GSyn[0],
+         mNoisyGSyn.data());
+}
+
 float LIF::getChannelTimeConst(enum ChannelType channel_type) {
    float channel_time_const = 0.0f;
    switch (channel_type) {
@@ -537,6 +558,65 @@ inline float LIF_Vmem_derivative(
    float Vmeminf          = (Vrest + V_E * G_E + V_I * G_I + V_IB * G_IB) / totalconductance;
    return totalconductance * (Vmeminf - Vmem) / tau;
 }
+//
+// add the noise to the excitatory, inhibitory and inhibitory-B inputs
+//
+// Each neuron draws from its own generator, in the same order as the update kernels drew from it
+// when the noise was part of them; so the noisy inputs, and the results of the update kernels
+// that read them, are the same as before the noise was given a pass of its own.
+//
+void LIF_add_noise(
+      const int numNeuronsAllBatches,
+      const float dt,
+      LIF_params const *params,
+      taus_uint4 *rnd,
+      float const *GSynHead,
+      float *noisyGSynHead) {
+   const float dt_sec = 0.001f * dt; // convert to seconds
+
+   float const *GSynExc  = &GSynHead[CHANNEL_EXC * numNeuronsAllBatches];
+   float const *GSynInh  = &GSynHead[CHANNEL_INH * numNeuronsAllBatches];
+   float const *GSynInhB = &GSynHead[CHANNEL_INHB * numNeuronsAllBatches];
+   float *noisyGSynExc   = &noisyGSynHead[CHANNEL_EXC * numNeuronsAllBatches];
+   float *noisyGSynInh   = &noisyGSynHead[CHANNEL_INH * numNeuronsAllBatches];
+   float *noisyGSynInhB  = &noisyGSynHead[CHANNEL_INHB * numNeuronsAllBatches];
+
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(static)
+#endif // PV_USE_OPENMP_THREADS
+   for (int k = 0; k < numNeuronsAllBatches; k++) {
+      taus_uint4 l_rnd = rnd[k];
+
+      float l_GSynExc  = GSynExc[k];
+      float l_GSynInh  = GSynInh[k];
+      float l_GSynInhB = GSynInhB[k];
+
+      l_rnd = cl_random_get(l_rnd);
+      if (cl_random_prob(l_rnd) < dt_sec * params->noiseFreqE) {
+         l_rnd     = cl_random_get(l_rnd);
+         l_GSynExc = l_GSynExc + params->noiseAmpE * cl_random_prob(l_rnd);
+      }
+
+      l_rnd = cl_random_get(l_rnd);
+      if (cl_random_prob(l_rnd) < dt_sec * params->noiseFreqI) {
+         l_rnd     = cl_random_get(l_rnd);
+         l_GSynInh = l_GSynInh + params->noiseAmpI * cl_random_prob(l_rnd);
+      }
+
+      l_rnd = cl_random_get(l_rnd);
+      if (cl_random_prob(l_rnd) < dt_sec * params->noiseFreqIB) {
+         l_rnd      = cl_random_get(l_rnd);
+         l_GSynInhB = l_GSynInhB + params->noiseAmpIB * cl_random_prob(l_rnd);
+      }
+
+      rnd[k] = l_rnd;
+
+      noisyGSynExc[k]  = l_GSynExc;
+      noisyGSynInh[k]  = l_GSynInh;
+      noisyGSynInhB[k] = l_GSynInhB;
+   }
+}
+
 //
 // update the state of a retinal layer (spiking)
 //
@@ -566,7 +646,7 @@ void LIF_update_state_original(
       const int up,
 
       LIF_params *params,
-      taus_uint4 *rnd,
+      float const *noisyGSynHead,
       float *V,
       float *Vth,
       float *G_E,
@@ -574,141 +654,131 @@ void LIF_update_state_original(
       float *G_IB,
       float *GSynHead,
       float *activity) {
-   int k;
-
    const float exp_tauE   = expf(-dt / params->tauE);
    const float exp_tauI   = expf(-dt / params->tauI);
    const float exp_tauIB  = expf(-dt / params->tauIB);
    const float exp_tauVth = expf(-dt / params->tauVth);
 
-   const float dt_sec = 0.001f * dt; // convert to seconds
-
-   for (k = 0; k < nx * ny * nf * nbatch; k++) {
-      int kex = kIndexExtendedBatch(k, nbatch, nx, ny, nf, lt, rt, dn, up);
-
-      //
-      // kernel (nonheader part) begins here
-      //
-
-      // local param variables
-      float tau, Vrest, VthRest, Vexc, Vinh, VinhB, deltaVth, deltaGIB;
-
-      const float GMAX = 10.0f;
-
-      // local variables
-      float l_activ;
-
-      taus_uint4 l_rnd = rnd[k];
-
-      float l_V   = V[k];
-      float l_Vth = Vth[k];
+   int const numExtended = (nx + lt + rt) * (ny + dn + up) * nf;
+   int const rowLength   = nx * nf;
+
+   float *GSynExc             = &GSynHead[CHANNEL_EXC * nbatch * numNeurons];
+   float *GSynInh             = &GSynHead[CHANNEL_INH * nbatch * numNeurons];
+   float *GSynInhB            = &GSynHead[CHANNEL_INHB * nbatch * numNeurons];
+   float const *noisyGSynExc  = &noisyGSynHead[CHANNEL_EXC * nbatch * numNeurons];
+   float const *noisyGSynInh  = &noisyGSynHead[CHANNEL_INH * nbatch * numNeurons];
+   float const *noisyGSynInhB = &noisyGSynHead[CHANNEL_INHB * nbatch * numNeurons];
 
-      float l_G_E  = G_E[k];
-      float l_G_I  = G_I[k];
-      float l_G_IB = G_IB[k];
+   // Each neuron depends only on its own state and inputs, so the rows of the layer are
+   // divided among the threads; the neurons of a row are contiguous in every buffer.
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(static)
+#endif // PV_USE_OPENMP_THREADS
+   for (int by = 0; by < nbatch * ny; by++) {
+      int const b      = by / ny;
+      int const y      = by % ny;
+      int const kRow   = by * rowLength;
+      int const kexRow = b * numExtended + ((y + up) * (nx + lt + rt) + lt) * nf;
+      for (int i = 0; i < rowLength; i++) {
+         int const k   = kRow + i;
+         int const kex = kexRow + i;
 
-      float *GSynExc   = &GSynHead[CHANNEL_EXC * nbatch * numNeurons];
-      float *GSynInh   = &GSynHead[CHANNEL_INH * nbatch * numNeurons];
-      float *GSynInhB  = &GSynHead[CHANNEL_INHB * nbatch * numNeurons];
-      float l_GSynExc  = GSynExc[k];
-      float l_GSynInh  = GSynInh[k];
-      float l_GSynInhB = GSynInhB[k];
+         //
+         // kernel (nonheader part) begins here
+         //
 
-      // temporary arrays
-      float tauInf, VmemInf;
+         // local param variables
+         float tau, Vrest, VthRest, Vexc, Vinh, VinhB, deltaVth, deltaGIB;
 
-      //
-      // start of LIF2_update_exact_linear
-      //
+         const float GMAX = 10.0f;
 
-      // define local param variables
-      //
-      tau   = params->tau;
-      Vexc  = params->Vexc;
-      Vinh  = params->Vinh;
-      VinhB = params->VinhB;
-      Vrest = params->Vrest;
+         // local variables
+         float l_activ;
 
-      VthRest  = params->VthRest;
-      deltaVth = params->deltaVth;
-      deltaGIB = params->deltaGIB;
+         float l_V   = V[k];
+         float l_Vth = Vth[k];
 
-      // add noise
-      //
+         float l_G_E  = G_E[k];
+         float l_G_I  = G_I[k];
+         float l_G_IB = G_IB[k];
 
-      l_rnd = cl_random_get(l_rnd);
-      if (cl_random_prob(l_rnd) < dt_sec * params->noiseFreqE) {
-         l_rnd     = cl_random_get(l_rnd);
-         l_GSynExc = l_GSynExc + params->noiseAmpE * cl_random_prob(l_rnd);
-      }
-
-      l_rnd = cl_random_get(l_rnd);
-      if (cl_random_prob(l_rnd) < dt_sec * params->noiseFreqI) {
-         l_rnd     = cl_random_get(l_rnd);
-         l_GSynInh = l_GSynInh + params->noiseAmpI * cl_random_prob(l_rnd);
-      }
+         float l_GSynExc  = noisyGSynExc[k];
+         float l_GSynInh  = noisyGSynInh[k];
+         float l_GSynInhB = noisyGSynInhB[k];
 
-      l_rnd = cl_random_get(l_rnd);
-      if (cl_random_prob(l_rnd) < dt_sec * params->noiseFreqIB) {
-         l_rnd      = cl_random_get(l_rnd);
-         l_GSynInhB = l_GSynInhB + params->noiseAmpIB * cl_random_prob(l_rnd);
-      }
+         // temporary arrays
+         float tauInf, VmemInf;
 
-      l_G_E  = l_GSynExc + l_G_E * exp_tauE;
-      l_G_I  = l_GSynInh + l_G_I * exp_tauI;
-      l_G_IB = l_GSynInhB + l_G_IB * exp_tauIB;
+         //
+         // start of LIF2_update_exact_linear
+         //
 
-      l_G_E  = (l_G_E > GMAX) ? GMAX : l_G_E;
-      l_G_I  = (l_G_I > GMAX) ? GMAX : l_G_I;
-      l_G_IB = (l_G_IB > GMAX) ? GMAX : l_G_IB;
+         // define local param variables
+         //
+         tau   = params->tau;
+         Vexc  = params->Vexc;
+         Vinh  = params->Vinh;
+         VinhB = params->VinhB;
+         Vrest = params->Vrest;
 
-      tauInf  = (dt / tau) * (1.0f + l_G_E + l_G_I + l_G_IB);
-      VmemInf = (Vrest + l_G_E * Vexc + l_G_I * Vinh + l_G_IB * VinhB)
-                / (1.0f + l_G_E + l_G_I + l_G_IB);
+         VthRest  = params->VthRest;
+         deltaVth = params->deltaVth;
+         deltaGIB = params->deltaGIB;
 
-      l_V = VmemInf + (l_V - VmemInf) * expf(-tauInf);
+         l_G_E  = l_GSynExc + l_G_E * exp_tauE;
+         l_G_I  = l_GSynInh + l_G_I * exp_tauI;
+         l_G_IB = l_GSynInhB + l_G_IB * exp_tauIB;
 
-      //
-      // start of LIF2_update_finish
-      //
+         l_G_E  = (l_G_E > GMAX) ? GMAX : l_G_E;
+         l_G_I  = (l_G_I > GMAX) ? GMAX : l_G_I;
+         l_G_IB = (l_G_IB > GMAX) ? GMAX : l_G_IB;
 
-      l_Vth = VthRest + (l_Vth - VthRest) * exp_tauVth;
+         tauInf  = (dt / tau) * (1.0f + l_G_E + l_G_I + l_G_IB);
+         VmemInf = (Vrest + l_G_E * Vexc + l_G_I * Vinh + l_G_IB * VinhB)
+                   / (1.0f + l_G_E + l_G_I + l_G_IB);
 
-      //
-      // start of update_f
-      //
+         l_V = VmemInf + (l_V - VmemInf) * expf(-tauInf);
 
-      bool fired_flag = (l_V > l_Vth);
+         //
+         // start of LIF2_update_finish
+         //
 
-      l_activ = fired_flag ? 1.0f : 0.0f;
-      l_V     = fired_flag ? Vrest : l_V;
-      l_Vth   = fired_flag ? l_Vth + deltaVth : l_Vth;
-      l_G_IB  = fired_flag ? l_G_IB + deltaGIB : l_G_IB;
+         l_Vth = VthRest + (l_Vth - VthRest) * exp_tauVth;
 
-      //
-      // These actions must be done outside of kernel
-      //    1. set activity to 0 in boundary (if needed)
-      //    2. update active indices
-      //
+         //
+         // start of update_f
+         //
 
-      // store local variables back to global memory
-      //
-      rnd[k] = l_rnd;
+         bool fired_flag = (l_V > l_Vth);
 
-      activity[kex] = l_activ;
+         l_activ = fired_flag ? 1.0f : 0.0f;
+         l_V     = fired_flag ? Vrest : l_V;
+         l_Vth   = fired_flag ? l_Vth + deltaVth : l_Vth;
+         l_G_IB  = fired_flag ? l_G_IB + deltaGIB : l_G_IB;
 
-      V[k]   = l_V;
-      Vth[k] = l_Vth;
+         //
+         // These actions must be done outside of kernel
+         //    1. set activity to 0 in boundary (if needed)
+         //    2. update active indices
+         //
+
+         // store local variables back to global memory
+         //
+         activity[kex] = l_activ;
+
+         V[k]   = l_V;
+         Vth[k] = l_Vth;
 
-      G_E[k]  = l_G_E;
-      G_I[k]  = l_G_I;
-      G_IB[k] = l_G_IB;
+         G_E[k]  = l_G_E;
+         G_I[k]  = l_G_I;
+         G_IB[k] = l_G_IB;
 
-      GSynExc[k]  = 0.0f;
-      GSynInh[k]  = 0.0f;
-      GSynInhB[k] = 0.0f;
+         GSynExc[k]  = 0.0f;
+         GSynInh[k]  = 0.0f;
+         GSynInhB[k] = 0.0f;
 
-   } // loop over k
+      }
+   }
 }
 
 void LIF_update_state_beginning(
@@ -726,7 +796,7 @@ void LIF_update_state_beginning(
       const int up,
 
       LIF_params *params,
-      taus_uint4 *rnd,
+      float const *noisyGSynHead,
       float *V,
       float *Vth,
       float *G_E,
@@ -737,148 +807,134 @@ void LIF_update_state_beginning(
       //    float * GSynInh,
       //    float * GSynInhB,
       float *activity) {
-   int k;
-
    const float exp_tauE   = expf(-dt / params->tauE);
    const float exp_tauI   = expf(-dt / params->tauI);
    const float exp_tauIB  = expf(-dt / params->tauIB);
    const float exp_tauVth = expf(-dt / params->tauVth);
 
-   const float dt_sec = 0.001f * dt; // convert to seconds
-
-   for (k = 0; k < nx * ny * nf * nbatch; k++) {
-
-      int kex = kIndexExtendedBatch(k, nbatch, nx, ny, nf, lt, rt, dn, up);
+   int const numExtended = (nx + lt + rt) * (ny + dn + up) * nf;
+   int const rowLength   = nx * nf;
+
+   float const *noisyGSynExc  = &noisyGSynHead[CHANNEL_EXC * nbatch * numNeurons];
+   float const *noisyGSynInh  = &noisyGSynHead[CHANNEL_INH * nbatch * numNeurons];
+   float const *noisyGSynInhB = &noisyGSynHead[CHANNEL_INHB * nbatch * numNeurons];
+
+   // Each neuron depends only on its own state and inputs, so the rows of the layer are
+   // divided among the threads; the neurons of a row are contiguous in every buffer.
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(static)
+#endif // PV_USE_OPENMP_THREADS
+   for (int by = 0; by < nbatch * ny; by++) {
+      int const b      = by / ny;
+      int const y      = by % ny;
+      int const kRow   = by * rowLength;
+      int const kexRow = b * numExtended + ((y + up) * (nx + lt + rt) + lt) * nf;
+      for (int i = 0; i < rowLength; i++) {
+         int const k   = kRow + i;
+         int const kex = kexRow + i;
+
+         //
+         // kernel (nonheader part) begins here
+         //
+
+         // local param variables
+         float tau, Vrest, VthRest, Vexc, Vinh, VinhB, deltaVth, deltaGIB;
+
+         const float GMAX = 10.0f;
+
+         // local variables
+         float l_activ;
+
+         float l_V   = V[k];
+         float l_Vth = Vth[k];
+
+         // The correction factors to the conductances are so that if l_GSyn_* is the same every
+         // timestep,
+         // then the asymptotic value of l_G_* will be l_GSyn_*
+         float l_G_E  = G_E[k];
+         float l_G_I  = G_I[k];
+         float l_G_IB = G_IB[k];
+
+         float l_GSynExc  = noisyGSynExc[k];
+         float l_GSynInh  = noisyGSynInh[k];
+         float l_GSynInhB = noisyGSynInhB[k];
+
+         //
+         // start of LIF2_update_exact_linear
+         //
+
+         // define local param variables
+         //
+         tau   = params->tau;
+         Vexc  = params->Vexc;
+         Vinh  = params->Vinh;
+         VinhB = params->VinhB;
+         Vrest = params->Vrest;
+
+         VthRest  = params->VthRest;
+         deltaVth = params->deltaVth;
+         deltaGIB = params->deltaGIB;
+
+         // The portion of code below uses the newer method of calculating l_V.
+         float G_E_initial, G_I_initial, G_IB_initial, G_E_final, G_I_final, G_IB_final;
+         float dV1, dV2, dV;
+
+         G_E_initial  = l_G_E + l_GSynExc;
+         G_I_initial  = l_G_I + l_GSynInh;
+         G_IB_initial = l_G_IB + l_GSynInhB;
+
+         G_E_initial  = (G_E_initial > GMAX) ? GMAX : G_E_initial;
+         G_I_initial  = (G_I_initial > GMAX) ? GMAX : G_I_initial;
+         G_IB_initial = (G_IB_initial > GMAX) ? GMAX : G_IB_initial;
+
+         G_E_final  = G_E_initial * exp_tauE;
+         G_I_final  = G_I_initial * exp_tauI;
+         G_IB_final = G_IB_initial * exp_tauIB;
+
+         dV1 = LIF_Vmem_derivative(
+               l_V, G_E_initial, G_I_initial, G_IB_initial, Vexc, Vinh, VinhB, Vrest, tau);
+         dV2 = LIF_Vmem_derivative(
+               l_V + dt * dV1, G_E_final, G_I_final, G_IB_final, Vexc, Vinh, VinhB, Vrest, tau);
+         dV  = (dV1 + dV2) * 0.5f;
+         l_V = l_V + dt * dV;
+
+         l_G_E  = G_E_final;
+         l_G_I  = G_I_final;
+         l_G_IB = G_IB_final;
+
+         l_Vth = VthRest + (l_Vth - VthRest) * exp_tauVth;
+         // End of code unique to newer method.
+
+         //
+         // start of update_f
+         //
+
+         bool fired_flag = (l_V > l_Vth);
+
+         l_activ = fired_flag ? 1.0f : 0.0f;
+         l_V     = fired_flag ? Vrest : l_V;
+         l_Vth   = fired_flag ? l_Vth + deltaVth : l_Vth;
+         l_G_IB  = fired_flag ? l_G_IB + deltaGIB : l_G_IB;
+
+         //
+         // These actions must be done outside of kernel
+         //    1. set activity to 0 in boundary (if needed)
+         //    2. update active indices
+         //
+
+         // store local variables back to global memory
+         //
+         activity[kex] = l_activ;
+
+         V[k]   = l_V;
+         Vth[k] = l_Vth;
+
+         G_E[k]  = l_G_E;
+         G_I[k]  = l_G_I;
+         G_IB[k] = l_G_IB;
 
-      //
-      // kernel (nonheader part) begins here
-      //
-
-      // local param variables
-      float tau, Vrest, VthRest, Vexc, Vinh, VinhB, deltaVth, deltaGIB;
-
-      const float GMAX = 10.0f;
-
-      // local variables
-      float l_activ;
-
-      taus_uint4 l_rnd = rnd[k];
-
-      float l_V   = V[k];
-      float l_Vth = Vth[k];
-
-      // The correction factors to the conductances are so that if l_GSyn_* is the same every
-      // timestep,
-      // then the asymptotic value of l_G_* will be l_GSyn_*
-      float l_G_E  = G_E[k];
-      float l_G_I  = G_I[k];
-      float l_G_IB = G_IB[k];
-
-      float *GSynExc   = &GSynHead[CHANNEL_EXC * nbatch * numNeurons];
-      float *GSynInh   = &GSynHead[CHANNEL_INH * nbatch * numNeurons];
-      float *GSynInhB  = &GSynHead[CHANNEL_INHB * nbatch * numNeurons];
-      float l_GSynExc  = GSynExc[k];
-      float l_GSynInh  = GSynInh[k];
-      float l_GSynInhB = GSynInhB[k];
-
-      //
-      // start of LIF2_update_exact_linear
-      //
-
-      // define local param variables
-      //
-      tau   = params->tau;
-      Vexc  = params->Vexc;
-      Vinh  = params->Vinh;
-      VinhB = params->VinhB;
-      Vrest = params->Vrest;
-
-      VthRest  = params->VthRest;
-      deltaVth = params->deltaVth;
-      deltaGIB = params->deltaGIB;
-
-      // add noise
-      //
-
-      l_rnd = cl_random_get(l_rnd);
-      if (cl_random_prob(l_rnd) < dt_sec * params->noiseFreqE) {
-         l_rnd     = cl_random_get(l_rnd);
-         l_GSynExc = l_GSynExc + params->noiseAmpE * cl_random_prob(l_rnd);
-      }
-
-      l_rnd = cl_random_get(l_rnd);
-      if (cl_random_prob(l_rnd) < dt_sec * params->noiseFreqI) {
-         l_rnd     = cl_random_get(l_rnd);
-         l_GSynInh = l_GSynInh + params->noiseAmpI * cl_random_prob(l_rnd);
-      }
-
-      l_rnd = cl_random_get(l_rnd);
-      if (cl_random_prob(l_rnd) < dt_sec * params->noiseFreqIB) {
-         l_rnd      = cl_random_get(l_rnd);
-         l_GSynInhB = l_GSynInhB + params->noiseAmpIB * cl_random_prob(l_rnd);
       }
-
-      // The portion of code below uses the newer method of calculating l_V.
-      float G_E_initial, G_I_initial, G_IB_initial, G_E_final, G_I_final, G_IB_final;
-      float dV1, dV2, dV;
-
-      G_E_initial  = l_G_E + l_GSynExc;
-      G_I_initial  = l_G_I + l_GSynInh;
-      G_IB_initial = l_G_IB + l_GSynInhB;
-
-      G_E_initial  = (G_E_initial > GMAX) ? GMAX : G_E_initial;
-      G_I_initial  = (G_I_initial > GMAX) ? GMAX : G_I_initial;
-      G_IB_initial = (G_IB_initial > GMAX) ? GMAX : G_IB_initial;
-
-      G_E_final  = G_E_initial * exp_tauE;
-      G_I_final  = G_I_initial * exp_tauI;
-      G_IB_final = G_IB_initial * exp_tauIB;
-
-      dV1 = LIF_Vmem_derivative(
-            l_V, G_E_initial, G_I_initial, G_IB_initial, Vexc, Vinh, VinhB, Vrest, tau);
-      dV2 = LIF_Vmem_derivative(
-            l_V + dt * dV1, G_E_final, G_I_final, G_IB_final, Vexc, Vinh, VinhB, Vrest, tau);
-      dV  = (dV1 + dV2) * 0.5f;
-      l_V = l_V + dt * dV;
-
-      l_G_E  = G_E_final;
-      l_G_I  = G_I_final;
-      l_G_IB = G_IB_final;
-
-      l_Vth = VthRest + (l_Vth - VthRest) * exp_tauVth;
-      // End of code unique to newer method.
-
-      //
-      // start of update_f
-      //
-
-      bool fired_flag = (l_V > l_Vth);
-
-      l_activ = fired_flag ? 1.0f : 0.0f;
-      l_V     = fired_flag ? Vrest : l_V;
-      l_Vth   = fired_flag ? l_Vth + deltaVth : l_Vth;
-      l_G_IB  = fired_flag ? l_G_IB + deltaGIB : l_G_IB;
-
-      //
-      // These actions must be done outside of kernel
-      //    1. set activity to 0 in boundary (if needed)
-      //    2. update active indices
-      //
-
-      // store local variables back to global memory
-      //
-      rnd[k] = l_rnd;
-
-      activity[kex] = l_activ;
-
-      V[k]   = l_V;
-      Vth[k] = l_Vth;
-
-      G_E[k]  = l_G_E;
-      G_I[k]  = l_G_I;
-      G_IB[k] = l_G_IB;
-
-   } // loop over k
+   }
 }
 
 void LIF_update_state_arma(
@@ -896,7 +952,7 @@ void LIF_update_state_arma(
       const int up,
 
       LIF_params *params,
-      taus_uint4 *rnd,
+      float const *noisyGSynHead,
       float *V,
       float *Vth,
       float *G_E,
@@ -904,153 +960,140 @@ void LIF_update_state_arma(
       float *G_IB,
       float *GSynHead,
       float *activity) {
-   int k;
-
    const float exp_tauE   = expf(-dt / params->tauE);
    const float exp_tauI   = expf(-dt / params->tauI);
    const float exp_tauIB  = expf(-dt / params->tauIB);
    const float exp_tauVth = expf(-dt / params->tauVth);
 
-   const float dt_sec = 0.001f * dt; // convert to seconds
-
-   for (k = 0; k < nx * ny * nf * nbatch; k++) {
-      int kex = kIndexExtendedBatch(k, nbatch, nx, ny, nf, lt, rt, dn, up);
-
-      //
-      // kernel (nonheader part) begins here
-      //
-
-      // local param variables
-      float tau, Vrest, VthRest, Vexc, Vinh, VinhB, deltaVth, deltaGIB;
-
-      const float GMAX = 10.0;
-
-      // local variables
-      float l_activ;
-
-      taus_uint4 l_rnd = rnd[k];
-
-      float l_V   = V[k];
-      float l_Vth = Vth[k];
-
-      // The correction factors to the conductances are so that if l_GSyn_* is the same every
-      // timestep,
-      // then the asymptotic value of l_G_* will be l_GSyn_*
-      float l_G_E  = G_E[k];
-      float l_G_I  = G_I[k];
-      float l_G_IB = G_IB[k];
-
-      float *GSynExc   = &GSynHead[CHANNEL_EXC * nbatch * numNeurons];
-      float *GSynInh   = &GSynHead[CHANNEL_INH * nbatch * numNeurons];
-      float *GSynInhB  = &GSynHead[CHANNEL_INHB * nbatch * numNeurons];
-      float l_GSynExc  = GSynExc[k];
-      float l_GSynInh  = GSynInh[k];
-      float l_GSynInhB = GSynInhB[k];
-
-      //
-      // start of LIF2_update_exact_linear
-      //
-
-      // define local param variables
-      //
-      tau   = params->tau;
-      Vexc  = params->Vexc;
-      Vinh  = params->Vinh;
-      VinhB = params->VinhB;
-      Vrest = params->Vrest;
-
-      VthRest  = params->VthRest;
-      deltaVth = params->deltaVth;
-      deltaGIB = params->deltaGIB;
-
-      // add noise
-      //
-
-      l_rnd = cl_random_get(l_rnd);
-      if (cl_random_prob(l_rnd) < dt_sec * params->noiseFreqE) {
-         l_rnd     = cl_random_get(l_rnd);
-         l_GSynExc = l_GSynExc + params->noiseAmpE * cl_random_prob(l_rnd);
+   int const numExtended = (nx + lt + rt) * (ny + dn + up) * nf;
+   int const rowLength   = nx * nf;
+
+   float const *noisyGSynExc  = &noisyGSynHead[CHANNEL_EXC * nbatch * numNeurons];
+   float const *noisyGSynInh  = &noisyGSynHead[CHANNEL_INH * nbatch * numNeurons];
+   float const *noisyGSynInhB = &noisyGSynHead[CHANNEL_INHB * nbatch * numNeurons];
+
+   // Each neuron depends only on its own state and inputs, so the rows of the layer are
+   // divided among the threads; the neurons of a row are contiguous in every buffer.
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(static)
+#endif // PV_USE_OPENMP_THREADS
+   for (int by = 0; by < nbatch * ny; by++) {
+      int const b      = by / ny;
+      int const y      = by % ny;
+      int const kRow   = by * rowLength;
+      int const kexRow = b * numExtended + ((y + up) * (nx + lt + rt) + lt) * nf;
+      for (int i = 0; i < rowLength; i++) {
+         int const k   = kRow + i;
+         int const kex = kexRow + i;
+
+         //
+         // kernel (nonheader part) begins here
+         //
+
+         // local param variables
+         float tau, Vrest, VthRest, Vexc, Vinh, VinhB, deltaVth, deltaGIB;
+
+         const float GMAX = 10.0;
+
+         // local variables
+         float l_activ;
+
+         float l_V   = V[k];
+         float l_Vth = Vth[k];
+
+         // The correction factors to the conductances are so that if l_GSyn_* is the same every
+         // timestep,
+         // then the asymptotic value of l_G_* will be l_GSyn_*
+         float l_G_E  = G_E[k];
+         float l_G_I  = G_I[k];
+         float l_G_IB = G_IB[k];
+
+         float l_GSynExc  = noisyGSynExc[k];
+         float l_GSynInh  = noisyGSynInh[k];
+         float l_GSynInhB = noisyGSynInhB[k];
+
+         //
+         // start of LIF2_update_exact_linear
+         //
+
+         // define local param variables
+         //
+         tau   = params->tau;
+         Vexc  = params->Vexc;
+         Vinh  = params->Vinh;
+         VinhB = params->VinhB;
+         Vrest = params->Vrest;
+
+         VthRest  = params->VthRest;
+         deltaVth = params->deltaVth;
+         deltaGIB = params->deltaGIB;
+
+         // The portion of code below uses the newer method of calculating l_V.
+         float G_E_initial, G_I_initial, G_IB_initial, G_E_final, G_I_final, G_IB_final;
+         float tau_inf_initial, tau_inf_final, V_inf_initial, V_inf_final;
+
+         G_E_initial     = l_G_E + l_GSynExc;
+         G_I_initial     = l_G_I + l_GSynInh;
+         G_IB_initial    = l_G_IB + l_GSynInhB;
+         tau_inf_initial = tau / (1 + G_E_initial + G_I_initial + G_IB_initial);
+         V_inf_initial   = (Vrest + Vexc * G_E_initial + Vinh * G_I_initial + VinhB * G_IB_initial)
+                         / (1 + G_E_initial + G_I_initial + G_IB_initial);
+
+         G_E_initial  = (G_E_initial > GMAX) ? GMAX : G_E_initial;
+         G_I_initial  = (G_I_initial > GMAX) ? GMAX : G_I_initial;
+         G_IB_initial = (G_IB_initial > GMAX) ? GMAX : G_IB_initial;
+
+         G_E_final  = G_E_initial * exp_tauE;
+         G_I_final  = G_I_initial * exp_tauI;
+         G_IB_final = G_IB_initial * exp_tauIB;
+
+         tau_inf_final = tau / (1 + G_E_final + G_I_final + G_IB_initial);
+         V_inf_final   = (Vrest + Vexc * G_E_final + Vinh * G_I_final + VinhB * G_IB_final)
+                       / (1 + G_E_final + G_I_final + G_IB_final);
+
+         float tau_slope = (tau_inf_final - tau_inf_initial) / dt;
+         float f1        = tau_slope == 0.0f ? expf(-dt / tau_inf_initial)
+                                      : powf(tau_inf_final / tau_inf_initial, -1 / tau_slope);
+         float f2 = tau_slope == -1.0f
+                          ? tau_inf_initial / dt * logf(tau_inf_final / tau_inf_initial + 1.0f)
+                          : (1 - tau_inf_initial / dt * (1 - f1)) / (1 + tau_slope);
+         float f3 = 1.0f - f1 - f2;
+         l_V      = f1 * l_V + f2 * V_inf_initial + f3 * V_inf_final;
+
+         l_G_E  = G_E_final;
+         l_G_I  = G_I_final;
+         l_G_IB = G_IB_final;
+
+         l_Vth = VthRest + (l_Vth - VthRest) * exp_tauVth;
+         // End of code unique to newer method.
+
+         //
+         // start of update_f
+         //
+
+         bool fired_flag = (l_V > l_Vth);
+
+         l_activ = fired_flag ? 1.0f : 0.0f;
+         l_V     = fired_flag ? Vrest : l_V;
+         l_Vth   = fired_flag ? l_Vth + deltaVth : l_Vth;
+         l_G_IB  = fired_flag ? l_G_IB + deltaGIB : l_G_IB;
+
+         //
+         // These actions must be done outside of kernel
+         //    1. set activity to 0 in boundary (if needed)
+         //    2. update active indices
+         //
+
+         // store local variables back to global memory
+         //
+         activity[kex] = l_activ;
+
+         V[k]   = l_V;
+         Vth[k] = l_Vth;
+
+         G_E[k]  = l_G_E;
+         G_I[k]  = l_G_I;
+         G_IB[k] = l_G_IB;
       }
-
-      l_rnd = cl_random_get(l_rnd);
-      if (cl_random_prob(l_rnd) < dt_sec * params->noiseFreqI) {
-         l_rnd     = cl_random_get(l_rnd);
-         l_GSynInh = l_GSynInh + params->noiseAmpI * cl_random_prob(l_rnd);
-      }
-
-      l_rnd = cl_random_get(l_rnd);
-      if (cl_random_prob(l_rnd) < dt_sec * params->noiseFreqIB) {
-         l_rnd      = cl_random_get(l_rnd);
-         l_GSynInhB = l_GSynInhB + params->noiseAmpIB * cl_random_prob(l_rnd);
-      }
-
-      // The portion of code below uses the newer method of calculating l_V.
-      float G_E_initial, G_I_initial, G_IB_initial, G_E_final, G_I_final, G_IB_final;
-      float tau_inf_initial, tau_inf_final, V_inf_initial, V_inf_final;
-
-      G_E_initial     = l_G_E + l_GSynExc;
-      G_I_initial     = l_G_I + l_GSynInh;
-      G_IB_initial    = l_G_IB + l_GSynInhB;
-      tau_inf_initial = tau / (1 + G_E_initial + G_I_initial + G_IB_initial);
-      V_inf_initial   = (Vrest + Vexc * G_E_initial + Vinh * G_I_initial + VinhB * G_IB_initial)
-                      / (1 + G_E_initial + G_I_initial + G_IB_initial);
-
-      G_E_initial  = (G_E_initial > GMAX) ? GMAX : G_E_initial;
-      G_I_initial  = (G_I_initial > GMAX) ? GMAX : G_I_initial;
-      G_IB_initial = (G_IB_initial > GMAX) ? GMAX : G_IB_initial;
-
-      G_E_final  = G_E_initial * exp_tauE;
-      G_I_final  = G_I_initial * exp_tauI;
-      G_IB_final = G_IB_initial * exp_tauIB;
-
-      tau_inf_final = tau / (1 + G_E_final + G_I_final + G_IB_initial);
-      V_inf_final   = (Vrest + Vexc * G_E_final + Vinh * G_I_final + VinhB * G_IB_final)
-                    / (1 + G_E_final + G_I_final + G_IB_final);
-
-      float tau_slope = (tau_inf_final - tau_inf_initial) / dt;
-      float f1        = tau_slope == 0.0f ? expf(-dt / tau_inf_initial)
-                                   : powf(tau_inf_final / tau_inf_initial, -1 / tau_slope);
-      float f2 = tau_slope == -1.0f
-                       ? tau_inf_initial / dt * logf(tau_inf_final / tau_inf_initial + 1.0f)
-                       : (1 - tau_inf_initial / dt * (1 - f1)) / (1 + tau_slope);
-      float f3 = 1.0f - f1 - f2;
-      l_V      = f1 * l_V + f2 * V_inf_initial + f3 * V_inf_final;
-
-      l_G_E  = G_E_final;
-      l_G_I  = G_I_final;
-      l_G_IB = G_IB_final;
-
-      l_Vth = VthRest + (l_Vth - VthRest) * exp_tauVth;
-      // End of code unique to newer method.
-
-      //
-      // start of update_f
-      //
-
-      bool fired_flag = (l_V > l_Vth);
-
-      l_activ = fired_flag ? 1.0f : 0.0f;
-      l_V     = fired_flag ? Vrest : l_V;
-      l_Vth   = fired_flag ? l_Vth + deltaVth : l_Vth;
-      l_G_IB  = fired_flag ? l_G_IB + deltaGIB : l_G_IB;
-
-      //
-      // These actions must be done outside of kernel
-      //    1. set activity to 0 in boundary (if needed)
-      //    2. update active indices
-      //
-
-      // store local variables back to global memory
-      //
-      rnd[k] = l_rnd;
-
-      activity[kex] = l_activ;
-
-      V[k]   = l_V;
-      Vth[k] = l_Vth;
-
-      G_E[k]  = l_G_E;
-      G_I[k]  = l_G_I;
-      G_IB[k] = l_G_IB;
    }
 }
@@ -74,6 +74,8 @@ class LIF : public PV::HyPerLayer {
 
    virtual bool activityIsSpiking() override { return true; }
 
+   virtual bool updatesWithoutMPI() const override { return true; }
+
   protected:
    LIF_params lParams;
    Random *randState;
@@ -85,6 +87,10 @@ class LIF : public PV::HyPerLayer {
    char *methodString; // 'arma', 'before', or 'original'
    char method; // 'a', 'b', or 'o', the first character of methodString
 
+   // The excitatory, inhibitory and inhibitory-B inputs with the noise added, for all batch
+   // elements, in that order.
+   std::vector<float> mNoisyGSyn;
+
   protected:
    LIF();
    int initialize(const char *name, HyPerCol *hc, const char *kernel_name);
@@ -117,6 +123,13 @@ class LIF : public PV::HyPerLayer {
    virtual void readG_IBFromCheckpoint(Checkpointer *checkpointer);
    virtual void readRandStateFromCheckpoint(Checkpointer *checkpointer);
 
+   /**
+    * Adds the noise given by the noiseAmp and noiseFreq parameters to the GSyn channels,
+    * writing the result to mNoisyGSyn, which the update kernels read instead of the first three
+    * GSyn channels. The GSyn channels themselves are not changed.
+    */
+   void addNoise(double dt);
+
   private:
    int initialize_base();
    int findPostSynaptic(
@@ -114,6 +114,7 @@ MaskLayer::communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage const>
          MPI_Barrier(parent->getCommunicator()->communicator());
          exit(EXIT_FAILURE);
       }
+      addUpdateDependency(maskLayer);
 
       const PVLayerLoc *maskLoc = maskLayer->getLayerLoc();
       const PVLayerLoc *loc     = getLayerLoc();
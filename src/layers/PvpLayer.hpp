@@ -2,7 +2,9 @@
 #define __PVPLAYER_HPP__
 
 #include "InputLayer.hpp"
-#include "utils/BufferUtilsPvp.hpp"
+#include "io/MappedPvpFile.hpp"
+
+#include <memory>
 
 namespace PV {
 
@@ -19,7 +21,10 @@ class PvpLayer : public InputLayer {
    virtual Response::Status allocateDataStructures() override;
 
   private:
-   struct BufferUtils::SparseFileTable sparseTable;
+   // Opened by countInputImages(), which every process that loads input calls: the root process
+   // of the MPI block, and in distributed mode each batch loader as well. retrieveData() reads
+   // frames from the mapping instead of reopening the file.
+   std::unique_ptr<MappedPvpFile> mPvpFile;
 };
 }
 
@@ -90,6 +90,7 @@ SegmentLayer::communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage con
       MPI_Barrier(parent->getCommunicator()->communicator());
       exit(EXIT_FAILURE);
    }
+   addUpdateDependency(originalLayer);
    if (originalLayer->getInitInfoCommunicatedFlag() == false) {
       return Response::POSTPONE;
    }
@@ -118,6 +118,7 @@ Segmentify::communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage const
       MPI_Barrier(parent->getCommunicator()->communicator());
       exit(EXIT_FAILURE);
    }
+   addUpdateDependency(originalLayer);
    if (originalLayer->getInitInfoCommunicatedFlag() == false) {
       return Response::POSTPONE;
    }
@@ -134,6 +135,7 @@ Segmentify::communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage const
       MPI_Barrier(parent->getCommunicator()->communicator());
       exit(EXIT_FAILURE);
    }
+   addUpdateDependency(segmentLayer);
 
    if (segmentLayer->getInitInfoCommunicatedFlag() == false) {
       return Response::POSTPONE;
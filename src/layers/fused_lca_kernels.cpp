@@ -0,0 +1,281 @@
+/*
+ * fused_lca_kernels.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "layers/fused_lca_kernels.hpp"
+#include "utils/PVAssert.hpp"
+#include "utils/PVLog.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// As in accumulate_kernels.cpp, the vectorized variants are compiled with per-function target
+// attributes. Here they all share one body, which is inlined into each variant and vectorized
+// by the compiler for that variant's instruction set.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define PV_FUSED_LCA_KERNELS_X86
+#endif // defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PV_FUSED_LCA_INLINE inline __attribute__((always_inline))
+#else
+#define PV_FUSED_LCA_INLINE inline
+#endif // defined(__GNUC__) || defined(__clang__)
+
+namespace PV {
+
+// One row of the restricted region: n consecutive neurons, which are also consecutive in the
+// extended activity buffer.
+struct FusedLCARow {
+   int n;
+   float *RESTRICT V;
+   float const *RESTRICT gExc;
+   float const *RESTRICT gInh; // nullptr if there is only one channel
+   float *RESTRICT A;
+   float *RESTRICT prevDrive;
+   float rate; // exp(-dt/tau) for the LCA rules, dt/tau for ISTA
+   uint32_t firstIndex; // extended index of A[0]
+   SparseList<float>::Entry *activeEntries; // nullptr if the active list is not wanted
+};
+
+typedef int (*FusedLCARowFunction)(FusedLCAArgs const &args, FusedLCARow const &row);
+
+// The loops are written without branches, with each element's result selected by a
+// conditional expression, so that they can be vectorized. Each loop stays within the row,
+// which is in the L1 cache after the first loop.
+template <FusedLCARule rule>
+static PV_FUSED_LCA_INLINE int fusedLCARowBody(FusedLCAArgs const &args, FusedLCARow const &r) {
+   int const n               = r.n;
+   float *RESTRICT V         = r.V;
+   float const *RESTRICT gE  = r.gExc;
+   float const *RESTRICT gI  = r.gInh;
+   float *RESTRICT A         = r.A;
+   float *RESTRICT prevDrive = r.prevDrive;
+   float const s             = args.selfInteract;
+
+   // Update V from the GSyn channels and the old activity.
+   if (rule == FUSED_LCA_HYPERLCA) {
+      float const e = r.rate;
+      if (gI) {
+         for (int k = 0; k < n; k++) {
+            V[k] = e * V[k] + (1.0f - e) * (gE[k] - gI[k] + s * A[k]);
+         }
+      }
+      else {
+         for (int k = 0; k < n; k++) {
+            V[k] = e * V[k] + (1.0f - e) * (gE[k] + s * A[k]);
+         }
+      }
+   }
+   else if (rule == FUSED_LCA_MOMENTUM) {
+      float const e = r.rate;
+      float const m = args.momentumRate;
+      for (int k = 0; k < n; k++) {
+         float const g     = gI ? gE[k] - gI[k] : gE[k];
+         float const drive = (1.0f - e) * (g + s * A[k]);
+         V[k]              = e * V[k] + drive + m * prevDrive[k];
+         prevDrive[k]      = drive;
+      }
+   }
+   else if (rule == FUSED_LCA_ISTA) {
+      float const dtOverTau = r.rate;
+      float const VThresh   = args.VThresh;
+      for (int k = 0; k < n; k++) {
+         float const g    = gI ? gE[k] - gI[k] : gE[k];
+         float const sign = A[k] != 0.0f ? A[k] / std::fabs(A[k]) : 0.0f;
+         V[k] += dtOverTau * (g - (VThresh * sign));
+      }
+   }
+
+   // Set the new activity.
+   if (rule == FUSED_LCA_ISTA) {
+      for (int k = 0; k < n; k++) {
+         A[k] = V[k];
+      }
+   }
+   else {
+      // The same piecewise linear function as setActivity_PtwiseLinearTransferLayer:
+      // start with the segment left of the first vertex, and let each vertex at or below V
+      // override it. At a vertex, the value is verticesA (continuous from the right).
+      int const last                  = args.numVertices - 1;
+      float const *RESTRICT verticesV = args.verticesV;
+      float const *RESTRICT verticesA = args.verticesA;
+      float const *RESTRICT slopes    = args.slopes;
+      for (int k = 0; k < n; k++) {
+         A[k] = verticesA[0] + slopes[0] * (V[k] - verticesV[0]);
+      }
+      for (int v = 0; v < last; v++) {
+         float const vV    = verticesV[v];
+         float const vA    = verticesA[v];
+         float const slope = slopes[v + 1];
+         for (int k = 0; k < n; k++) {
+            float const segment = V[k] == vV ? vA : vA + slope * (V[k] - vV);
+            A[k]                = V[k] >= vV ? segment : A[k];
+         }
+      }
+      float const lastV     = verticesV[last];
+      float const lastA     = verticesA[last];
+      float const lastSlope = slopes[args.numVertices];
+      for (int k = 0; k < n; k++) {
+         A[k] = V[k] >= lastV ? lastA + lastSlope * (V[k] - lastV) : A[k];
+      }
+   }
+
+   // Record the active neurons of the row.
+   int numActive = 0;
+   if (r.activeEntries) {
+      for (int k = 0; k < n; k++) {
+         if (A[k] != 0.0f) {
+            r.activeEntries[numActive].index = r.firstIndex + (uint32_t)k;
+            r.activeEntries[numActive].value = A[k];
+            numActive++;
+         }
+      }
+   }
+   return numActive;
+}
+
+template <FusedLCARule rule>
+static int fusedLCARowScalar(FusedLCAArgs const &args, FusedLCARow const &row) {
+   return fusedLCARowBody<rule>(args, row);
+}
+
+#ifdef PV_FUSED_LCA_KERNELS_X86
+template <FusedLCARule rule>
+__attribute__((target("avx2,fma"))) static int
+fusedLCARowAVX2(FusedLCAArgs const &args, FusedLCARow const &row) {
+   return fusedLCARowBody<rule>(args, row);
+}
+
+template <FusedLCARule rule>
+__attribute__((target("avx512f"))) static int
+fusedLCARowAVX512(FusedLCAArgs const &args, FusedLCARow const &row) {
+   return fusedLCARowBody<rule>(args, row);
+}
+#endif // PV_FUSED_LCA_KERNELS_X86
+
+template <FusedLCARule rule>
+static FusedLCARowFunction getFusedLCARowFunction(AccumulateKernelVariant variant) {
+   switch (variant) {
+#ifdef PV_FUSED_LCA_KERNELS_X86
+      case ACCUMULATE_KERNEL_AVX2: return fusedLCARowAVX2<rule>;
+      case ACCUMULATE_KERNEL_AVX512: return fusedLCARowAVX512<rule>;
+#endif // PV_FUSED_LCA_KERNELS_X86
+      // On ARM, the scalar body is vectorized with NEON, which the baseline instruction set
+      // includes.
+      default: return fusedLCARowScalar<rule>;
+   }
+}
+
+static FusedLCARowFunction
+getFusedLCARowFunction(FusedLCARule rule, AccumulateKernelVariant variant) {
+   switch (rule) {
+      case FUSED_LCA_HYPERLCA: return getFusedLCARowFunction<FUSED_LCA_HYPERLCA>(variant);
+      case FUSED_LCA_MOMENTUM: return getFusedLCARowFunction<FUSED_LCA_MOMENTUM>(variant);
+      case FUSED_LCA_ISTA: return getFusedLCARowFunction<FUSED_LCA_ISTA>(variant);
+      default: pvAssert(0); return nullptr;
+   }
+}
+
+// The rate in FusedLCARow, computed exactly as the separate applyGSyn_ kernels compute it.
+static float fusedLCARate(FusedLCARule rule, double dt, float tau) {
+   switch (rule) {
+      case FUSED_LCA_HYPERLCA: return (float)std::exp(-dt / (double)tau);
+      case FUSED_LCA_MOMENTUM: return std::exp((float)-dt / tau);
+      case FUSED_LCA_ISTA: return (float)dt / tau;
+      default: pvAssert(0); return 0.0f;
+   }
+}
+
+void fusedLCAUpdate(FusedLCAArgs const &args, AccumulateKernelVariant variant) {
+   FatalIf(
+         getAccumulateKernels(variant) == nullptr,
+         "fusedLCAUpdate: instruction set variant %d is not supported on this CPU.\n",
+         (int)variant);
+   FusedLCARowFunction rowFunction = getFusedLCARowFunction(args.rule, variant);
+
+   PVLayerLoc const *loc = args.loc;
+   PVHalo const *halo    = &loc->halo;
+   int const nbatch      = loc->nbatch;
+   int const ny          = loc->ny;
+   int const rowLength   = loc->nx * loc->nf;
+   int const numNeurons  = ny * rowLength;
+   int const rowStride   = (loc->nx + halo->lt + halo->rt) * loc->nf;
+   int const numExtended = (loc->ny + halo->dn + halo->up) * rowStride;
+   int const firstIndex  = halo->up * rowStride + halo->lt * loc->nf;
+   float const *gSynExc  = args.GSynHead;
+   float const *gSynInh  = args.numChannels >= 2 ? args.GSynHead + nbatch * numNeurons : nullptr;
+   bool const findActive = args.activeIndices != nullptr;
+   std::vector<int> rowActiveCounts(findActive ? nbatch * ny : 0);
+
+   std::vector<float> rates(nbatch);
+   for (int b = 0; b < nbatch; b++) {
+      rates[b] = fusedLCARate(args.rule, args.dtAdapt[b], args.tau);
+   }
+
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(static)
+#endif // PV_USE_OPENMP_THREADS
+   for (int by = 0; by < nbatch * ny; by++) {
+      int const b         = by / ny;
+      int const y         = by % ny;
+      int const kRestrict = b * numNeurons + y * rowLength;
+      int const kExtended = firstIndex + y * rowStride;
+      FusedLCARow row;
+      row.n             = rowLength;
+      row.V             = &args.V[kRestrict];
+      row.gExc          = &gSynExc[kRestrict];
+      row.gInh          = gSynInh ? &gSynInh[kRestrict] : nullptr;
+      row.A             = &args.activity[b * numExtended + kExtended];
+      row.prevDrive     = args.prevDrive ? &args.prevDrive[kRestrict] : nullptr;
+      row.rate          = rates[b];
+      row.firstIndex    = (uint32_t)kExtended;
+      row.activeEntries = findActive ? &args.activeIndices[kRestrict] : nullptr;
+      int numActive     = rowFunction(args, row);
+      if (findActive) {
+         rowActiveCounts[by] = numActive;
+      }
+   }
+
+   // Each row wrote its entries at the start of its own slot. Move them together; the
+   // destination never passes the source, so copying forward is safe.
+   if (findActive) {
+      for (int b = 0; b < nbatch; b++) {
+         SparseList<float>::Entry *batchEntries = &args.activeIndices[b * numNeurons];
+         long count                             = 0L;
+         for (int y = 0; y < ny; y++) {
+            SparseList<float>::Entry *rowEntries = &batchEntries[y * rowLength];
+            int const rowCount                   = rowActiveCounts[b * ny + y];
+            if (&batchEntries[count] != rowEntries) {
+               std::copy(rowEntries, rowEntries + rowCount, &batchEntries[count]);
+            }
+            count += rowCount;
+         }
+         args.numActive[b] = count;
+      }
+   }
+}
+
+// Returns the variant whose kernels getAccumulateKernels() chose, so that the layer update and
+// the delivery use the same instruction set.
+static AccumulateKernelVariant findBestFusedLCAVariant() {
+   AccumulateKernels const *best = &getAccumulateKernels();
+   for (int v = 0; v < (int)ACCUMULATE_KERNEL_NUM_VARIANTS; v++) {
+      AccumulateKernelVariant variant = (AccumulateKernelVariant)v;
+      if (getAccumulateKernels(variant) == best) {
+         return variant;
+      }
+   }
+   return ACCUMULATE_KERNEL_SCALAR;
+}
+
+void fusedLCAUpdate(FusedLCAArgs const &args) {
+   // Function-level static initialization is thread-safe in C++11.
+   static AccumulateKernelVariant const variant = findBestFusedLCAVariant();
+   fusedLCAUpdate(args, variant);
+}
+
+} // namespace PV
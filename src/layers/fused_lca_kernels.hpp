@@ -0,0 +1,72 @@
+/*
+ * fused_lca_kernels.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef FUSED_LCA_KERNELS_HPP_
+#define FUSED_LCA_KERNELS_HPP_
+
+#include "delivery/accumulate_kernels.hpp"
+#include "include/PVLayerLoc.h"
+#include "structures/SparseList.hpp"
+
+namespace PV {
+
+/**
+ * The update rules of the LCA family of layers, as computed on the GPU by the updateV_ kernels
+ * in updateStateFunctions.h:
+ *
+ * HyPerLCALayer:    V = e * V + (1 - e) * (G + s * A),  A = T(V)
+ * MomentumLCALayer: D = (1 - e) * (G + s * A),  V = e * V + D + m * Dprev,  Dprev = D,  A = T(V)
+ * ISTALayer:        V = V + (dt / tau) * (G - VThresh * sign(A)),  A = V
+ *
+ * where G is the excitatory channel minus the inhibitory channel (if there are two channels),
+ * e = exp(-dt / tau), s is selfInteract, m is LCAMomentumRate, and T is the piecewise linear
+ * transfer function given by verticesV, verticesA and slopes.
+ */
+enum FusedLCARule { FUSED_LCA_HYPERLCA, FUSED_LCA_MOMENTUM, FUSED_LCA_ISTA };
+
+struct FusedLCAArgs {
+   FusedLCARule rule;
+   PVLayerLoc const *loc;
+   int numChannels;
+   float *V;
+   float const *GSynHead;
+   float *activity; // extended
+   float *prevDrive; // MomentumLCALayer only
+   int numVertices; // The transfer function is not used by ISTALayer
+   float const *verticesV;
+   float const *verticesA;
+   float const *slopes;
+   double const *dtAdapt; // one per batch element
+   float tau;
+   float selfInteract;
+   float momentumRate;
+   float VThresh; // ISTALayer only
+
+   // If activeIndices is not null, the nonzero activities of the restricted region of batch
+   // element b are written, in order, with extended indices, to the numNeurons entries beginning
+   // at activeIndices[b * numNeurons], and their number to numActive[b].
+   SparseList<float>::Entry *activeIndices;
+   long *numActive;
+};
+
+/**
+ * Applies the update rule to the CPU buffers in a single pass: each row of the restricted
+ * region reads the GSyn channels and the old activity, updates V, and writes the new activity
+ * and its active entries, before moving on to the next row. Rows are divided among the OpenMP
+ * threads, and the loops along a row are vectorized for the given instruction set, which must
+ * be supported (see getAccumulateKernels(AccumulateKernelVariant)).
+ * The result is the same as the separate applyGSyn_ and setActivity_ passes, up to round-off.
+ */
+void fusedLCAUpdate(FusedLCAArgs const &args, AccumulateKernelVariant variant);
+
+/**
+ * Applies the update rule with the fastest instruction set the CPU supports.
+ */
+void fusedLCAUpdate(FusedLCAArgs const &args);
+
+} // namespace PV
+
+#endif // FUSED_LCA_KERNELS_HPP_
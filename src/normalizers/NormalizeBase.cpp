@@ -63,18 +63,9 @@ void NormalizeBase::ioParam_normalizeOnWeightUpdate(enum ParamsIOFlag ioFlag) {
          mNormalizeOnWeightUpdate);
 }
 
-Response::Status NormalizeBase::respond(std::shared_ptr<BaseMessage const> message) {
-   Response::Status status = BaseObject::respond(message);
-   if (status != Response::SUCCESS) {
-      return status;
-   }
-   else if (
-         auto castMessage = std::dynamic_pointer_cast<ConnectionNormalizeMessage const>(message)) {
-      return respondConnectionNormalize(castMessage);
-   }
-   else {
-      return status;
-   }
+void NormalizeBase::initMessageActionMap() {
+   BaseObject::initMessageActionMap();
+   setMessageAction(&NormalizeBase::respondConnectionNormalize);
 }
 
 Response::Status NormalizeBase::respondConnectionNormalize(
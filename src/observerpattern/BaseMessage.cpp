@@ -0,0 +1,19 @@
+/*
+ * BaseMessage.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "observerpattern/BaseMessage.hpp"
+#include <map>
+#include <typeindex>
+
+namespace PV {
+
+int BaseMessage::messageIdOf(std::type_info const &messageType) {
+   static std::map<std::type_index, int> messageIds;
+   auto insertion = messageIds.emplace(std::type_index(messageType), (int)messageIds.size());
+   return insertion.first->second;
+}
+
+} // namespace PV
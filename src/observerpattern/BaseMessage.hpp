@@ -12,6 +12,7 @@
 #define BASEMESSAGE_HPP_
 
 #include <string>
+#include <typeinfo>
 
 namespace PV {
 
@@ -21,12 +22,40 @@ class BaseMessage {
    virtual ~BaseMessage() {}
    inline std::string const &getMessageType() const { return mMessageType; }
 
+   /**
+    * Returns the message ID of the dynamic type of the message. The ID is looked up the first
+    * time the method is called, and cached in the message after that.
+    */
+   int getMessageId() const {
+      if (mMessageId < 0) {
+         mMessageId = messageIdOf(typeid(*this));
+      }
+      return mMessageId;
+   }
+
+   /**
+    * Returns the message ID of the message class T. Message IDs are small nonnegative integers,
+    * assigned consecutively the first time each class is looked up, so that they can be used as
+    * indices into a table of message handlers.
+    */
+   template <typename T>
+   static int messageIdOf() {
+      static int const id = messageIdOf(typeid(T));
+      return id;
+   }
+
+   /**
+    * Returns the message ID of the message class with the given type_info.
+    */
+   static int messageIdOf(std::type_info const &messageType);
+
   protected:
    inline void setMessageType(std::string const &messageType) { mMessageType = messageType; }
    inline void setMessageType(char const *messageType) { mMessageType = messageType; }
 
   private:
    std::string mMessageType = "";
+   mutable int mMessageId   = -1;
 };
 
 } // namespace PV
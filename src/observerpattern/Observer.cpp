@@ -0,0 +1,45 @@
+/*
+ * Observer.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "observerpattern/Observer.hpp"
+#include "utils/PVAssert.hpp"
+#include <map>
+#include <typeindex>
+
+namespace PV {
+
+Response::Status Observer::respond(std::shared_ptr<BaseMessage const> message) {
+   if (message == nullptr) {
+      return Response::NO_ACTION;
+   }
+   int const messageId = message->getMessageId();
+   auto const &actions = getMessageActions();
+   if (messageId < (int)actions.size() and actions[messageId] != nullptr) {
+      return actions[messageId](this, message);
+   }
+   else {
+      return Response::NO_ACTION;
+   }
+}
+
+void Observer::setMessageAction(int messageId, MessageAction action) {
+   pvAssert(mMessageActions != nullptr and messageId >= 0);
+   if (messageId >= (int)mMessageActions->size()) {
+      mMessageActions->resize(messageId + 1);
+   }
+   (*mMessageActions)[messageId] = action;
+}
+
+void Observer::initMessageActions() {
+   static std::map<std::type_index, std::vector<MessageAction>> classMessageActions;
+   auto insertion  = classMessageActions.emplace(typeid(*this), std::vector<MessageAction>());
+   mMessageActions = &insertion.first->second;
+   if (insertion.second) {
+      initMessageActionMap();
+   }
+}
+
+} /* namespace PV */
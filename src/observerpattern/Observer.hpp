@@ -11,23 +11,96 @@
 #include "include/pv_common.h"
 #include "observerpattern/BaseMessage.hpp"
 #include "observerpattern/Response.hpp"
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace PV {
 
+/**
+ * The observer class of the observer pattern.
+ *
+ * An Observer responds to messages through a table of message actions, indexed by message ID
+ * (see BaseMessage::getMessageId()). Derived classes fill the table by overriding
+ * initMessageActionMap() to call the base class's initMessageActionMap() and then
+ * setMessageAction() once for each message type they handle. The table is built the first time
+ * an object of a given class needs it, and is shared by all objects of that class, so that
+ * respond() resolves a message with a single lookup, and Subject::notify() can skip objects
+ * that have no action for a message.
+ */
 class Observer {
   public:
    Observer() {}
    virtual ~Observer() {}
-   virtual Response::Status respond(std::shared_ptr<BaseMessage const> message) {
-      return Response::NO_ACTION;
+
+   /**
+    * Calls the action registered for the message's type, if there is one. Returns NO_ACTION if
+    * there is no such action, or if the message is null.
+    */
+   virtual Response::Status respond(std::shared_ptr<BaseMessage const> message);
+
+   /**
+    * Returns true if the object has an action for the message type with the given ID.
+    */
+   bool respondsTo(int messageId) {
+      auto const &actions = getMessageActions();
+      return messageId < (int)actions.size() and actions[messageId] != nullptr;
    }
+
    inline std::string const &getDescription() const { return description; }
    inline char const *getDescription_c() const { return description.c_str(); }
 
+  protected:
+   typedef std::function<Response::Status(Observer *, std::shared_ptr<BaseMessage const>)>
+         MessageAction;
+
+   /**
+    * The virtual method for registering the object's message actions. It is called once per
+    * class, on the first object of that class to use the table; therefore the actions must not
+    * depend on the state of any particular object.
+    */
+   virtual void initMessageActionMap() {}
+
+   /**
+    * Sets the action for the message type with the given ID, replacing any action that a base
+    * class registered for that type.
+    */
+   void setMessageAction(int messageId, MessageAction action);
+
+   /**
+    * A convenience method for the common case where the action is a member function that takes
+    * a shared_ptr to the message type: setMessageAction(&MyClass::respondMyMessage).
+    */
+   template <typename C, typename T>
+   void setMessageAction(Response::Status (C::*method)(std::shared_ptr<T const>)) {
+      setMessageAction(
+            BaseMessage::messageIdOf<T>(),
+            [method](Observer *observer, std::shared_ptr<BaseMessage const> message) {
+               auto castMessage = std::static_pointer_cast<T const>(message);
+               return (static_cast<C *>(observer)->*method)(castMessage);
+            });
+   }
+
+  private:
+   std::vector<MessageAction> const &getMessageActions() {
+      if (mMessageActions == nullptr) {
+         initMessageActions();
+      }
+      return *mMessageActions;
+   }
+
+   /**
+    * Points mMessageActions to the table for the object's class, building the table by calling
+    * initMessageActionMap() if no object of the class has done so yet.
+    */
+   void initMessageActions();
+
    // Data members
   protected:
    std::string description;
+
+  private:
+   std::vector<MessageAction> *mMessageActions = nullptr;
 };
 
 } /* namespace PV */
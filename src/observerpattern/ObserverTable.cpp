@@ -26,6 +26,7 @@ bool ObserverTable::addObject(std::string const &name, Observer *entry) {
    // successful.
    if (addSucceeded) {
       mObjectVector.emplace_back(entry);
+      clearRespondingObjects();
    }
    return addSucceeded;
 }
@@ -33,12 +34,13 @@ bool ObserverTable::addObject(std::string const &name, Observer *entry) {
 void ObserverTable::deleteObject(std::string const &name, bool deallocateFlag) {
    Observer *obj        = nullptr;
    auto mapSearchResult = mObjectMap.find(name);
-   if (mapSearchResult == mObjectMap.end()) {
+   if (mapSearchResult != mObjectMap.end()) {
       obj                     = mapSearchResult->second;
       auto vectorSearchResult = find(mObjectVector.begin(), mObjectVector.end(), obj);
       pvAssert(vectorSearchResult != mObjectVector.end());
       mObjectMap.erase(mapSearchResult);
       mObjectVector.erase(vectorSearchResult);
+      clearRespondingObjects();
       if (deallocateFlag) {
          delete obj;
       }
@@ -53,6 +55,25 @@ void ObserverTable::clear(bool deallocateFlag) {
    }
    mObjectVector.clear();
    mObjectMap.clear();
+   clearRespondingObjects();
+}
+
+std::vector<Observer *> const &ObserverTable::getObjectsRespondingTo(int messageId) const {
+   if (messageId >= (int)mRespondingObjects.size()) {
+      mRespondingObjects.resize(messageId + 1);
+      mRespondingObjectsBuilt.resize(messageId + 1, false);
+   }
+   auto &respondingObjects = mRespondingObjects[messageId];
+   if (!mRespondingObjectsBuilt[messageId]) {
+      respondingObjects.clear();
+      for (auto &obj : mObjectVector) {
+         if (obj->respondsTo(messageId)) {
+            respondingObjects.push_back(obj);
+         }
+      }
+      mRespondingObjectsBuilt[messageId] = true;
+   }
+   return respondingObjects;
 }
 
 } /* namespace PV */
@@ -31,6 +31,14 @@ class ObserverTable {
 
    std::vector<Observer *> const &getObjectVector() const { return mObjectVector; }
    std::map<std::string, Observer *> const &getObjectMap() const { return mObjectMap; }
+
+   /**
+    * Returns the objects in the table that have an action for the message type with the given
+    * ID, in the same order as the object vector. The list for each message ID is built the first
+    * time it is requested, and kept until an object is added or deleted.
+    */
+   std::vector<Observer *> const &getObjectsRespondingTo(int messageId) const;
+
    Observer *getObject(std::string const &name) const {
       auto lookupResult = mObjectMap.find(name);
       return lookupResult == mObjectMap.end() ? nullptr : lookupResult->second;
@@ -60,9 +68,19 @@ class ObserverTable {
       return lookupResult;
    }
 
+  private:
+   void clearRespondingObjects() {
+      mRespondingObjectsBuilt.assign(mRespondingObjectsBuilt.size(), false);
+   }
+
   private:
    std::vector<Observer *> mObjectVector;
    std::map<std::string, Observer *> mObjectMap;
+
+   // mRespondingObjects[id] is the list returned by getObjectsRespondingTo(id), and
+   // mRespondingObjectsBuilt[id] is whether it has been built.
+   mutable std::vector<std::vector<Observer *>> mRespondingObjects;
+   mutable std::vector<bool> mRespondingObjectsBuilt;
 };
 
 } /* namespace PV */
@@ -17,11 +17,19 @@ Response::Status Subject::notify(
       std::vector<std::shared_ptr<BaseMessage const>> messages,
       bool printFlag) {
    Response::Status returnStatus = Response::NO_ACTION;
-   auto &objectVector            = table.getObjectVector();
+   // With a single message, only visit the objects that have an action for it. Otherwise, visit
+   // every object, and skip the messages it has no action for.
+   bool const singleMessage = messages.size() == 1 and messages[0] != nullptr;
+   auto &objectVector       = singleMessage
+                                 ? table.getObjectsRespondingTo(messages[0]->getMessageId())
+                                 : table.getObjectVector();
    std::vector<int> numPostponed(messages.size());
    for (auto &obj : objectVector) {
       for (int msgIdx = 0; msgIdx < messages.size(); msgIdx++) {
-         auto &msg               = messages[msgIdx];
+         auto &msg = messages[msgIdx];
+         if (!singleMessage and msg != nullptr and !obj->respondsTo(msg->getMessageId())) {
+            continue;
+         }
          Response::Status status = obj->respond(msg);
          returnStatus            = returnStatus + status;
 
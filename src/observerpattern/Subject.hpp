@@ -68,6 +68,8 @@ class Subject {
     * Generally each message in the messages vector is sent to each object in the table.
     * However, if an object returns POSTPONE in response to a message, the loop skips to
     * the next object, and does not sent any remaining messages to the postponing object.
+    * Also, a message is not sent to objects that have no action for its type (see
+    * Observer::respondsTo()); they are treated as if they had returned NO_ACTION.
     *
     * The rationale behind these rules is so that if the objects in the table are themselves
     * derived from the Subject class, the messages can be passed down the tree and the
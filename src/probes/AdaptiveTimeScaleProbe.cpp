@@ -150,17 +150,9 @@ Response::Status AdaptiveTimeScaleProbe::registerData(Checkpointer *checkpointer
    return Response::SUCCESS;
 }
 
-Response::Status AdaptiveTimeScaleProbe::respond(std::shared_ptr<BaseMessage const> message) {
-   Response::Status status = ColProbe::respond(message);
-   if (message == nullptr) {
-      return status;
-   }
-   else if (auto castMessage = std::dynamic_pointer_cast<AdaptTimestepMessage const>(message)) {
-      return respondAdaptTimestep(castMessage);
-   }
-   else {
-      return status;
-   }
+void AdaptiveTimeScaleProbe::initMessageActionMap() {
+   ColProbe::initMessageActionMap();
+   setMessageAction(&AdaptiveTimeScaleProbe::respondAdaptTimestep);
 }
 
 Response::Status
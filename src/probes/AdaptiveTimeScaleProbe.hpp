@@ -79,13 +79,14 @@ class AdaptiveTimeScaleProbe : public ColProbe {
   public:
    AdaptiveTimeScaleProbe(char const *name, HyPerCol *hc);
    virtual ~AdaptiveTimeScaleProbe();
-   virtual Response::Status respond(std::shared_ptr<BaseMessage const> message) override;
    virtual Response::Status
    communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage const> message) override;
    virtual Response::Status allocateDataStructures() override;
    virtual Response::Status outputState(double timeValue) override;
 
   protected:
+   virtual void initMessageActionMap() override;
+
    AdaptiveTimeScaleProbe();
    int initialize(char const *name, HyPerCol *hc);
    int ioParamsFillGroup(enum ParamsIOFlag ioFlag) override;
@@ -27,22 +27,10 @@ void BaseConnectionProbe::ioParam_targetName(enum ParamsIOFlag ioFlag) {
    }
 }
 
-Response::Status BaseConnectionProbe::respond(std::shared_ptr<BaseMessage const> message) {
-   Response::Status status = BaseProbe::respond(message);
-   if (status != Response::SUCCESS) {
-      return status;
-   }
-   else if (
-         auto castMessage =
-               std::dynamic_pointer_cast<ConnectionProbeWriteParamsMessage const>(message)) {
-      return respondConnectionProbeWriteParams(castMessage);
-   }
-   else if (auto castMessage = std::dynamic_pointer_cast<ConnectionOutputMessage const>(message)) {
-      return respondConnectionOutput(castMessage);
-   }
-   else {
-      return status;
-   }
+void BaseConnectionProbe::initMessageActionMap() {
+   BaseProbe::initMessageActionMap();
+   setMessageAction(&BaseConnectionProbe::respondConnectionProbeWriteParams);
+   setMessageAction(&BaseConnectionProbe::respondConnectionOutput);
 }
 
 Response::Status BaseConnectionProbe::respondConnectionProbeWriteParams(
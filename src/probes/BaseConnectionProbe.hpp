@@ -21,11 +21,11 @@ class BaseConnectionProbe : public BaseProbe {
    BaseConnectionProbe(const char *name, HyPerCol *hc);
    virtual ~BaseConnectionProbe();
 
-   virtual Response::Status respond(std::shared_ptr<BaseMessage const> message) override;
-
    BaseConnection *getTargetConn() { return mTargetConn; }
 
   protected:
+   virtual void initMessageActionMap() override;
+
    BaseConnectionProbe(); // Default constructor, can only be called by derived
    // classes
    int initialize(const char *name, HyPerCol *hc);
@@ -47,8 +47,6 @@ class ColProbe : public BaseProbe {
     */
    virtual ~ColProbe();
 
-   virtual Response::Status respond(std::shared_ptr<BaseMessage const> message) override;
-
    /**
     * Calls BaseProbe::communicateInitInfo (which sets up any triggering or
     * attaching to an energy probe)
@@ -65,6 +63,8 @@ class ColProbe : public BaseProbe {
    virtual Response::Status outputState(double timed) override { return Response::SUCCESS; }
 
   protected:
+   virtual void initMessageActionMap() override;
+
    /**
     * The constructor without arguments should be used by derived classes.
     */
@@ -83,13 +83,27 @@ void BorderExchange::newDatatypes() {
    blocklength = nf * rightBorder;
    MPI_Type_vector(count, blocklength, stride, MPI_FLOAT, &mDatatypes[SOUTHEAST]);
    MPI_Type_commit(&mDatatypes[SOUTHEAST]);
+
+   // Batch elements are stored contiguously, each occupying the whole extended layer.
+   int const numExtended      = stride * (mLayerLoc.ny + bottomBorder + topBorder);
+   MPI_Aint const batchStride = (MPI_Aint)numExtended * (MPI_Aint)sizeof(float);
+   mBatchDatatypes.resize(NUM_NEIGHBORHOOD);
+   for (int n = 0; n < NUM_NEIGHBORHOOD; n++) {
+      MPI_Type_create_hvector(mLayerLoc.nbatch, 1, batchStride, mDatatypes[n], &mBatchDatatypes[n]);
+      MPI_Type_commit(&mBatchDatatypes[n]);
+   }
 #else // PV_USE_MPI
    mDatatypes.clear();
+   mBatchDatatypes.clear();
 #endif // PV_USE_MPI
 }
 
 void BorderExchange::freeDatatypes() {
 #ifdef PV_USE_MPI
+   for (auto &d : mBatchDatatypes) {
+      MPI_Type_free(&d);
+   }
+   mBatchDatatypes.clear();
    for (auto &d : mDatatypes) {
       MPI_Type_free(&d);
    }
@@ -117,6 +131,17 @@ void BorderExchange::initNeighbors() {
 }
 
 void BorderExchange::exchange(float *data, std::vector<MPI_Request> &req) {
+   postExchange(data, mDatatypes, req);
+}
+
+void BorderExchange::exchangeBatch(float *data, std::vector<MPI_Request> &req) {
+   postExchange(data, mBatchDatatypes, req);
+}
+
+void BorderExchange::postExchange(
+      float *data,
+      std::vector<MPI_Datatype> const &datatypes,
+      std::vector<MPI_Request> &req) {
 #ifdef PV_USE_MPI
    PVHalo const &halo = mLayerLoc.halo;
    if (halo.lt == 0 && halo.rt == 0 && halo.dn == 0 && halo.up == 0) {
@@ -135,7 +160,7 @@ void BorderExchange::exchange(float *data, std::vector<MPI_Request> &req) {
       MPI_Irecv(
             recvBuf,
             1,
-            mDatatypes[n],
+            datatypes[n],
             neighbors[n],
             exchangeCounter * 16 + mTags[revDir],
             mMPIBlock->getComm(),
@@ -151,7 +176,7 @@ void BorderExchange::exchange(float *data, std::vector<MPI_Request> &req) {
       MPI_Isend(
             sendBuf,
             1,
-            mDatatypes[n],
+            datatypes[n],
             neighbors[n],
             exchangeCounter * 16 + mTags[n],
             mMPIBlock->getComm(),
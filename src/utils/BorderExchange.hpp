@@ -17,8 +17,19 @@ class BorderExchange {
    BorderExchange(MPIBlock const &mpiBlock, PVLayerLoc const &loc);
    ~BorderExchange();
 
+   /**
+    * Posts the sends and receives that exchange the border region of one batch element of
+    * the layer. The requests are returned in req.
+    */
    void exchange(float *data, std::vector<MPI_Request> &req);
 
+   /**
+    * Posts the sends and receives that exchange the border regions of all loc.nbatch batch
+    * elements, which begin at data and are stored contiguously. Each neighbor receives one
+    * message for the whole batch, instead of one message per batch element.
+    */
+   void exchangeBatch(float *data, std::vector<MPI_Request> &req);
+
    static int wait(std::vector<MPI_Request> &req);
 
    MPIBlock const *getMPIBlock() const { return mMPIBlock; }
@@ -49,6 +60,15 @@ class BorderExchange {
    void newDatatypes();
    void freeDatatypes();
 
+   /**
+    * Posts a receive and a send to each neighbor, using datatypes[direction] for the region
+    * in that direction.
+    */
+   void postExchange(
+         float *data,
+         std::vector<MPI_Datatype> const &datatypes,
+         std::vector<MPI_Request> &req);
+
    void initNeighbors();
 
    /**
@@ -82,6 +102,7 @@ class BorderExchange {
    MPIBlock const *mMPIBlock = nullptr; // TODO: copy mpiBlock instead of storing a pointer.
    PVLayerLoc mLayerLoc;
    std::vector<MPI_Datatype> mDatatypes;
+   std::vector<MPI_Datatype> mBatchDatatypes; // mDatatypes, repeated for each batch element
    std::vector<int> neighbors;
    unsigned int mNumNeighbors;
 
@@ -0,0 +1,108 @@
+/*
+ * philox.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef PHILOX_HPP_
+#define PHILOX_HPP_
+
+#include <cstdint>
+
+namespace PV {
+
+/**
+ * The Philox4x32-10 counter-based random number generator of Salmon et al., "Parallel Random
+ * Numbers: As Easy as 1, 2, 3" (SC11). Each call maps a 128-bit counter and a 64-bit key to
+ * 128 random bits. There is no state: the n-th number of a stream is computed directly from n,
+ * so streams can be generated in any order, by any number of threads, and in vectorized blocks.
+ */
+struct Philox4x32 {
+   static std::uint32_t const M0 = 0xD2511F53U;
+   static std::uint32_t const M1 = 0xCD9E8D57U;
+   static std::uint32_t const W0 = 0x9E3779B9U;
+   static std::uint32_t const W1 = 0xBB67AE85U;
+   static int const numRounds    = 10;
+
+   /**
+    * Computes the four outputs for the given counter and key.
+    */
+   static inline void
+   generate(std::uint32_t const counter[4], std::uint32_t const key[2], std::uint32_t out[4]) {
+      std::uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+      std::uint32_t k0 = key[0], k1 = key[1];
+      for (int r = 0; r < numRounds; r++) {
+         round(c0, c1, c2, c3, k0, k1);
+         k0 += W0;
+         k1 += W1;
+      }
+      out[0] = c0;
+      out[1] = c1;
+      out[2] = c2;
+      out[3] = c3;
+   }
+
+   /**
+    * Fills out[0..4*numBlocks) with the outputs for the counters
+    * (firstBlock + j, counter1, counter2, counter3), j = 0, ..., numBlocks - 1.
+    * The blocks are computed a fixed-size group at a time, each round a loop across the group,
+    * so that the compiler can vectorize the rounds.
+    */
+   static inline void generateBlocks(
+         std::uint32_t firstBlock,
+         std::uint32_t counter1,
+         std::uint32_t counter2,
+         std::uint32_t counter3,
+         std::uint32_t const key[2],
+         int numBlocks,
+         std::uint32_t *out) {
+      int const groupSize = 16;
+      std::uint32_t c0[groupSize], c1[groupSize], c2[groupSize], c3[groupSize];
+      for (int start = 0; start < numBlocks; start += groupSize) {
+         int const n = numBlocks - start < groupSize ? numBlocks - start : groupSize;
+         for (int j = 0; j < groupSize; j++) {
+            c0[j] = firstBlock + (std::uint32_t)(start + j);
+            c1[j] = counter1;
+            c2[j] = counter2;
+            c3[j] = counter3;
+         }
+         std::uint32_t k0 = key[0], k1 = key[1];
+         for (int r = 0; r < numRounds; r++) {
+            for (int j = 0; j < groupSize; j++) {
+               round(c0[j], c1[j], c2[j], c3[j], k0, k1);
+            }
+            k0 += W0;
+            k1 += W1;
+         }
+         std::uint32_t *groupOut = &out[4 * start];
+         for (int j = 0; j < n; j++) {
+            groupOut[4 * j]     = c0[j];
+            groupOut[4 * j + 1] = c1[j];
+            groupOut[4 * j + 2] = c2[j];
+            groupOut[4 * j + 3] = c3[j];
+         }
+      }
+   }
+
+  private:
+   static inline void round(
+         std::uint32_t &c0,
+         std::uint32_t &c1,
+         std::uint32_t &c2,
+         std::uint32_t &c3,
+         std::uint32_t k0,
+         std::uint32_t k1) {
+      std::uint64_t const p0 = (std::uint64_t)M0 * (std::uint64_t)c0;
+      std::uint64_t const p1 = (std::uint64_t)M1 * (std::uint64_t)c2;
+      std::uint32_t const n0 = (std::uint32_t)(p1 >> 32) ^ c1 ^ k0;
+      std::uint32_t const n2 = (std::uint32_t)(p0 >> 32) ^ c3 ^ k1;
+      c1                     = (std::uint32_t)p1;
+      c3                     = (std::uint32_t)p0;
+      c0                     = n0;
+      c2                     = n2;
+   }
+};
+
+} // namespace PV
+
+#endif // PHILOX_HPP_
@@ -35,6 +35,13 @@ class BaseWeightUpdater : public BaseObject {
 
    virtual void updateState(double timestamp, double dt) {}
 
+   /**
+    * Called after each phase of layer updates, so that an updater with nonblocking
+    * communication in flight can let it progress while the layers compute. The default
+    * does nothing.
+    */
+   virtual void progressCommunication() {}
+
    bool getPlasticityFlag() const { return mPlasticityFlag; };
 
   protected:
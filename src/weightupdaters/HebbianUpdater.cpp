@@ -12,6 +12,8 @@
 #include "utils/MapLookupByType.hpp"
 #include "utils/TransposeWeights.hpp"
 
+#include <algorithm>
+
 namespace PV {
 
 HebbianUpdater::HebbianUpdater(char const *name, HyPerCol *hc) { initialize(name, hc); }
@@ -37,6 +39,7 @@ int HebbianUpdater::ioParamsFillGroup(enum ParamsIOFlag ioFlag) {
    ioParam_normalizeDw(ioFlag);
    ioParam_useMask(ioFlag);
    ioParam_combine_dW_with_W_flag(ioFlag);
+   ioParam_dWReduceChunkSize(ioFlag);
    return PV_SUCCESS;
 }
 
@@ -193,6 +196,24 @@ void HebbianUpdater::ioParam_combine_dW_with_W_flag(enum ParamsIOFlag ioFlag) {
    }
 }
 
+void HebbianUpdater::ioParam_dWReduceChunkSize(enum ParamsIOFlag ioFlag) {
+   pvAssert(!parent->parameters()->presentAndNotBeenRead(name, "plasticityFlag"));
+   if (mPlasticityFlag) {
+      parent->parameters()->ioParamValue(
+            ioFlag,
+            name,
+            "dWReduceChunkSize",
+            &mDWReduceChunkSize,
+            mDWReduceChunkSize,
+            false /*warnIfAbsent*/);
+      FatalIf(
+            mDWReduceChunkSize < 0,
+            "%s: dWReduceChunkSize must be nonnegative (value was %d).\n",
+            getDescription_c(),
+            mDWReduceChunkSize);
+   }
+}
+
 Response::Status
 HebbianUpdater::communicateInitInfo(std::shared_ptr<CommunicateInitInfoMessage const> message) {
    auto componentMap       = message->mHierarchy;
@@ -311,6 +332,27 @@ Response::Status HebbianUpdater::allocateDataStructures() {
             mNumKernelActivations[arborId] = (mNumKernelActivations[0] + sp * nPatches * arborId);
          } // loop over arbors
       }
+
+      // Parallelizing over kernels leaves threads idle if there are only a few kernels per
+      // thread. In that case, parallelize over batch elements and presynaptic neurons, with
+      // a private copy of dW for each thread.
+      int const numThreads          = parent->getNumThreads();
+      int const minKernelsPerThread = 4;
+      if (mWeights->getSharedFlag() and numThreads > 1
+          and mDeltaWeights->getNumDataPatches() < minKernelsPerThread * numThreads) {
+         std::size_t const arborSize = (std::size_t)mDeltaWeights->getNumDataPatches()
+                                       * (std::size_t)mDeltaWeights->getPatchSizeOverall();
+         mThreadDeltaWeights.resize(numThreads);
+         for (auto &th : mThreadDeltaWeights) {
+            th.resize(arborSize);
+         }
+         if (mNumKernelActivations) {
+            mThreadNumKernelActivations.resize(numThreads);
+            for (auto &th : mThreadNumKernelActivations) {
+               th.resize(arborSize);
+            }
+         }
+      }
    }
 
    if (mPlasticityFlag && !mTriggerLayer) {
@@ -421,6 +463,8 @@ void HebbianUpdater::updateWeightsDelayed(double simTime, double dt) {
 
 void HebbianUpdater::updateLocal_dW() {
    pvAssert(mPlasticityFlag);
+   // The dW buffers are reduced in place, so the previous reduction must be complete.
+   pvAssert(!mReductionPending);
    int status          = PV_SUCCESS;
    int const numArbors = mArborList->getNumAxonalArbors();
    for (int arborId = 0; arborId < numArbors; arborId++) {
@@ -515,10 +559,27 @@ int HebbianUpdater::update_dW(int arborID) {
    int const nbatch      = loc->nbatch;
    int delay             = mArborList->getDelay(arborID);
 
+   if (!mThreadDeltaWeights.empty()) {
+      update_dWWithThreadShards(arborID);
+      return PV_SUCCESS;
+   }
+
    float const *preactbufHead  = pre->getLayerData(delay);
    float const *postactbufHead = post->getLayerData();
 
-   if (mWeights->getSharedFlag()) {
+   if (pre->getSparseFlag()) {
+      PVLayerCube preCube = pre->getPublisher()->createCube(delay);
+      for (int b = 0; b < nbatch; b++) {
+         update_dWFromActiveIndices(
+               arborID,
+               b,
+               preactbufHead,
+               postactbufHead,
+               (SparseList<float>::Entry const *)preCube.activeIndices + b * nExt,
+               preCube.numActive[b]);
+      }
+   }
+   else if (mWeights->getSharedFlag()) {
       // Calculate x and y cell size
       int xCellSize  = zUnitCellSize(pre->getXScale(), post->getXScale());
       int yCellSize  = zUnitCellSize(pre->getYScale(), post->getYScale());
@@ -576,9 +637,23 @@ int HebbianUpdater::update_dW(int arborID) {
       pvAssert(c->getPre()->getLayerLoc()->nbatch == nbatch);
       float const *clonePre  = c->getPre()->getLayerData(delay);
       float const *clonePost = c->getPost()->getLayerData();
-      for (int b = 0; b < nbatch; b++) {
-         for (int kExt = 0; kExt < nExt; kExt++) {
-            updateInd_dW(arborID, b, clonePre, clonePost, kExt);
+      if (c->getPre()->getSparseFlag()) {
+         PVLayerCube cloneCube = c->getPre()->getPublisher()->createCube(delay);
+         for (int b = 0; b < nbatch; b++) {
+            update_dWFromActiveIndices(
+                  arborID,
+                  b,
+                  clonePre,
+                  clonePost,
+                  (SparseList<float>::Entry const *)cloneCube.activeIndices + b * nExt,
+                  cloneCube.numActive[b]);
+         }
+      }
+      else {
+         for (int b = 0; b < nbatch; b++) {
+            for (int kExt = 0; kExt < nExt; kExt++) {
+               updateInd_dW(arborID, b, clonePre, clonePost, kExt);
+            }
          }
       }
    }
@@ -586,12 +661,201 @@ int HebbianUpdater::update_dW(int arborID) {
    return PV_SUCCESS;
 }
 
+void HebbianUpdater::update_dWFromActiveIndices(
+      int arborID,
+      int batchID,
+      float const *preLayerData,
+      float const *postLayerData,
+      SparseList<float>::Entry const *activeIndices,
+      long numActive) {
+   if (mWeights->getSharedFlag()) {
+      // Counting sort of the active neurons by kernel. The active list is in increasing order
+      // of extended index, and the sort is stable, so each kernel's neurons stay in that order.
+      int const numKernels = mWeights->getNumDataPatches();
+      mKernelActiveStarts.assign(numKernels + 1, 0);
+      mKernelActiveNeurons.resize(numActive);
+      for (long n = 0; n < numActive; n++) {
+         int kernelIndex = mWeights->calcDataIndexFromPatchIndex((int)activeIndices[n].index);
+         mKernelActiveStarts[kernelIndex + 1]++;
+      }
+      for (int k = 0; k < numKernels; k++) {
+         mKernelActiveStarts[k + 1] += mKernelActiveStarts[k];
+      }
+      std::vector<int> position(mKernelActiveStarts.begin(), mKernelActiveStarts.end() - 1);
+      for (long n = 0; n < numActive; n++) {
+         int kExt        = (int)activeIndices[n].index;
+         int kernelIndex = mWeights->calcDataIndexFromPatchIndex(kExt);
+         mKernelActiveNeurons[position[kernelIndex]++] = kExt;
+      }
+
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (int kernelIndex = 0; kernelIndex < numKernels; kernelIndex++) {
+         int const stop = mKernelActiveStarts[kernelIndex + 1];
+         for (int n = mKernelActiveStarts[kernelIndex]; n < stop; n++) {
+            updateInd_dW(arborID, batchID, preLayerData, postLayerData, mKernelActiveNeurons[n]);
+         }
+      }
+   }
+   else {
+      // Each presynaptic neuron has its own patch, so the active neurons can be done in parallel.
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (long n = 0; n < numActive; n++) {
+         updateInd_dW(arborID, batchID, preLayerData, postLayerData, (int)activeIndices[n].index);
+      }
+   }
+}
+
+void HebbianUpdater::update_dWWithThreadShards(int arborID) {
+   pvAssert(mWeights->getSharedFlag());
+   int const delay  = mArborList->getDelay(arborID);
+   int const nExt   = mConnectionData->getPre()->getNumExtended();
+   int const nbatch = mConnectionData->getPre()->getLayerLoc()->nbatch;
+
+   // The connection and its plastic clones all contribute. Retrieve their data before the
+   // threads start, since retrieving it may wait on the publishers.
+   struct Source {
+      float const *preData;
+      float const *postData;
+      SparseList<float>::Entry const *activeIndices; // null if the presynaptic layer is dense
+      long const *numActive;
+   };
+   std::vector<ConnectionData *> connections(1, mConnectionData);
+   connections.insert(connections.end(), mClones.begin(), mClones.end());
+   std::vector<Source> sources;
+   for (auto *c : connections) {
+      Source source;
+      source.preData       = c->getPre()->getLayerData(delay);
+      source.postData      = c->getPost()->getLayerData();
+      source.activeIndices = nullptr;
+      source.numActive     = nullptr;
+      if (c->getPre()->getSparseFlag()) {
+         PVLayerCube preCube  = c->getPre()->getPublisher()->createCube(delay);
+         source.activeIndices = (SparseList<float>::Entry const *)preCube.activeIndices;
+         source.numActive     = preCube.numActive;
+      }
+      sources.push_back(source);
+   }
+
+   // The runtime may give the team fewer threads than there are copies. Only the copies of the
+   // threads in the team are cleared and filled, so only those are summed.
+   int const numCopies = (int)mThreadDeltaWeights.size();
+   int numTeamThreads  = 1;
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel num_threads(numCopies)
+#endif
+   {
+#ifdef PV_USE_OPENMP_THREADS
+      int const thread = omp_get_thread_num();
+#pragma omp single nowait
+      numTeamThreads = omp_get_num_threads();
+#else
+      int const thread = 0;
+#endif // PV_USE_OPENMP_THREADS
+      pvAssert(thread < numCopies);
+      std::vector<float> &dW = mThreadDeltaWeights[thread];
+      std::fill(dW.begin(), dW.end(), 0.0f);
+      long *activations = nullptr;
+      if (!mThreadNumKernelActivations.empty()) {
+         std::vector<long> &threadActivations = mThreadNumKernelActivations[thread];
+         std::fill(threadActivations.begin(), threadActivations.end(), 0L);
+         activations = threadActivations.data();
+      }
+
+      // Every thread encounters the same sequence of loops, so the loops can be shared without
+      // waiting at the end of each one.
+      for (auto const &source : sources) {
+         for (int b = 0; b < nbatch; b++) {
+            if (source.activeIndices) {
+               SparseList<float>::Entry const *activeBatch = source.activeIndices + b * nExt;
+               long const numActive                        = source.numActive[b];
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp for schedule(static) nowait
+#endif
+               for (long n = 0; n < numActive; n++) {
+                  updateInd_dW(
+                        arborID,
+                        b,
+                        source.preData,
+                        source.postData,
+                        (int)activeBatch[n].index,
+                        dW.data(),
+                        activations);
+               }
+            }
+            else {
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp for schedule(static) nowait
+#endif
+               for (int kExt = 0; kExt < nExt; kExt++) {
+                  updateInd_dW(
+                        arborID, b, source.preData, source.postData, kExt, dW.data(), activations);
+               }
+            }
+         }
+      }
+   }
+
+   // Sum the copies in thread order, so that the result depends only on the number of threads.
+   int const numThreads        = numTeamThreads;
+   std::size_t const arborSize = mThreadDeltaWeights[0].size();
+   float *dWArbor              = mDeltaWeights->getData(arborID);
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(static)
+#endif
+   for (std::size_t k = 0; k < arborSize; k++) {
+      float sum = dWArbor[k];
+      for (int t = 0; t < numThreads; t++) {
+         sum += mThreadDeltaWeights[t][k];
+      }
+      dWArbor[k] = sum;
+   }
+   if (!mThreadNumKernelActivations.empty()) {
+      long *activationArbor = mNumKernelActivations[arborID];
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(static)
+#endif
+      for (std::size_t k = 0; k < arborSize; k++) {
+         long sum = activationArbor[k];
+         for (int t = 0; t < numThreads; t++) {
+            sum += mThreadNumKernelActivations[t][k];
+         }
+         activationArbor[k] = sum;
+      }
+   }
+}
+
 void HebbianUpdater::updateInd_dW(
       int arborID,
       int batchID,
       float const *preLayerData,
       float const *postLayerData,
       int kExt) {
+   long *activations = nullptr;
+   if (mWeights->getSharedFlag() && mNormalizeDw) {
+      activations = mNumKernelActivations[arborID];
+   }
+   updateInd_dW(
+         arborID,
+         batchID,
+         preLayerData,
+         postLayerData,
+         kExt,
+         mDeltaWeights->getData(arborID),
+         activations);
+}
+
+void HebbianUpdater::updateInd_dW(
+      int arborID,
+      int batchID,
+      float const *preLayerData,
+      float const *postLayerData,
+      int kExt,
+      float *dWData,
+      long *activationData) {
    HyPerLayer *pre           = mConnectionData->getPre();
    HyPerLayer *post          = mConnectionData->getPost();
    const PVLayerLoc *postLoc = post->getLayerLoc();
@@ -620,15 +884,12 @@ void HebbianUpdater::updateInd_dW(
    int sym                 = 0;
    const float *maskactRef = NULL;
 
-   float *dwdata =
-         mDeltaWeights->getDataFromPatchIndex(arborID, kExt) + mDeltaWeights->getPatch(kExt).offset;
-   long *activations = nullptr;
-   if (mWeights->getSharedFlag() && mNormalizeDw) {
-      int dataIndex        = mWeights->calcDataIndexFromPatchIndex(kExt);
-      int patchSizeOverall = mWeights->getPatchSizeOverall();
-      int patchOffset      = mWeights->getPatch(kExt).offset;
-      activations = &mNumKernelActivations[arborID][dataIndex * patchSizeOverall + patchOffset];
-   }
+   // The position of the patch's first active weight within the arbor.
+   std::ptrdiff_t patchStart = mDeltaWeights->getDataFromPatchIndex(arborID, kExt)
+                               - mDeltaWeights->getData(arborID)
+                               + mDeltaWeights->getPatch(kExt).offset;
+   float *dwdata     = dWData + patchStart;
+   long *activations = activationData ? activationData + patchStart : nullptr;
 
    int syp         = mWeights->getPatchStrideY();
    int lineoffsetw = 0;
@@ -696,17 +957,7 @@ int HebbianUpdater::reduceKernels(int arborID) {
       const size_t patchSize  = (size_t)mWeights->getPatchSizeOverall();
       const size_t localSize  = (size_t)numPatches * (size_t)patchSize;
       const size_t arborSize  = localSize * (size_t)mArborList->getNumAxonalArbors();
-
-      auto sz = mDeltaWeightsReduceRequests.size();
-      mDeltaWeightsReduceRequests.resize(sz + 1);
-      MPI_Iallreduce(
-            MPI_IN_PLACE,
-            mDeltaWeights->getData(arborID),
-            arborSize,
-            MPI_FLOAT,
-            MPI_SUM,
-            mpi_comm,
-            &(mDeltaWeightsReduceRequests.data())[sz]);
+      startReduction(mDeltaWeights->getData(arborID), arborSize, MPI_FLOAT, mpi_comm);
    }
 
    return PV_BREAK;
@@ -725,17 +976,7 @@ int HebbianUpdater::reduceActivations(int arborID) {
       const size_t patchSize  = (size_t)mWeights->getPatchSizeOverall();
       const size_t localSize  = numPatches * patchSize;
       const size_t arborSize  = localSize * mArborList->getNumAxonalArbors();
-
-      auto sz = mDeltaWeightsReduceRequests.size();
-      mDeltaWeightsReduceRequests.resize(sz + 1);
-      MPI_Iallreduce(
-            MPI_IN_PLACE,
-            mNumKernelActivations[arborID],
-            arborSize,
-            MPI_LONG,
-            MPI_SUM,
-            mpi_comm,
-            &(mDeltaWeightsReduceRequests.data())[sz]);
+      startReduction(mNumKernelActivations[arborID], arborSize, MPI_LONG, mpi_comm);
    }
 
    return PV_BREAK;
@@ -749,17 +990,43 @@ void HebbianUpdater::reduceAcrossBatch(int arborID) {
       size_t const localSize   = (size_t)numPatches * (size_t)patchSize;
       size_t const arborSize   = localSize * (size_t)mArborList->getNumAxonalArbors();
       MPI_Comm const batchComm = parent->getCommunicator()->batchCommunicator();
+      startReduction(mDeltaWeights->getData(arborID), arborSize, MPI_FLOAT, batchComm);
+   }
+}
 
-      auto sz = mDeltaWeightsReduceRequests.size();
-      mDeltaWeightsReduceRequests.resize(sz + 1);
+template <typename T>
+void HebbianUpdater::startReduction(
+      T *buffer,
+      std::size_t count,
+      MPI_Datatype datatype,
+      MPI_Comm comm) {
+   std::size_t const chunkSize = mDWReduceChunkSize > 0 ? (std::size_t)mDWReduceChunkSize : count;
+   for (std::size_t start = 0; start < count; start += chunkSize) {
+      std::size_t const chunkCount = std::min(chunkSize, count - start);
+      MPI_Request request;
       MPI_Iallreduce(
             MPI_IN_PLACE,
-            mDeltaWeights->getData(arborID),
-            arborSize,
-            MPI_FLOAT,
+            buffer + start,
+            (int)chunkCount,
+            datatype,
             MPI_SUM,
-            batchComm,
-            &(mDeltaWeightsReduceRequests.data())[sz]);
+            comm,
+            &request);
+      mDeltaWeightsReduceRequests.push_back(request);
+   }
+}
+
+void HebbianUpdater::progressCommunication() {
+   if (!mDeltaWeightsReduceRequests.empty()) {
+      int allDone = 0;
+      MPI_Testall(
+            (int)mDeltaWeightsReduceRequests.size(),
+            mDeltaWeightsReduceRequests.data(),
+            &allDone,
+            MPI_STATUSES_IGNORE);
+      if (allDone) {
+         mDeltaWeightsReduceRequests.clear();
+      }
    }
 }
 
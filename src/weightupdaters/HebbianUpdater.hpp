@@ -33,6 +33,17 @@ class HebbianUpdater : public BaseWeightUpdater {
    virtual void ioParam_useMask(enum ParamsIOFlag ioFlag);
    virtual void ioParam_combine_dW_with_W_flag(enum ParamsIOFlag ioFlag);
 
+   /**
+    * @brief dWReduceChunkSize: The number of values in each nonblocking MPI reduction of dW.
+    * @details Splitting the reduction into chunks lets the MPI library make progress on it
+    * between the phases of the next timestep's layer updates, which matters when
+    * immediateWeightUpdate is false and the reduced dW is not applied until the next weight
+    * update. The default, zero, reduces each buffer with a single request. For a given MPI
+    * configuration and chunk size the results are deterministic; they are not guaranteed to be
+    * bitwise identical across different chunk sizes.
+    */
+   virtual void ioParam_dWReduceChunkSize(enum ParamsIOFlag ioFlag);
+
    /** @} */ // end of HebbianUpdater parameters
 
   public:
@@ -50,6 +61,11 @@ class HebbianUpdater : public BaseWeightUpdater {
       return mDeltaWeights->getDataFromDataIndex(arborId, dataIndex);
    }
 
+   /**
+    * Tests the pending dW reductions, without waiting for them to finish.
+    */
+   virtual void progressCommunication() override;
+
   protected:
    HebbianUpdater() {}
 
@@ -99,6 +115,43 @@ class HebbianUpdater : public BaseWeightUpdater {
          float const *postLayerData,
          int kExt);
 
+   /**
+    * Adds the contribution of one presynaptic neuron to the given dW and activation-count
+    * buffers, which have the layout of one arbor of mDeltaWeights. activationData is null if
+    * activations are not being counted.
+    */
+   void updateInd_dW(
+         int arborID,
+         int batchID,
+         float const *preLayerData,
+         float const *postLayerData,
+         int kExt,
+         float *dWData,
+         long *activationData);
+
+   /**
+    * Computes one arbor's dW, for shared weights with too few kernels to keep the threads busy.
+    * Each thread accumulates the contributions of a share of the batch elements and presynaptic
+    * neurons into its own copy of the dW and activation-count buffers, without locks; the
+    * copies are then summed into mDeltaWeights, each thread summing a range of weights over all
+    * the copies in thread order.
+    */
+   void update_dWWithThreadShards(int arborID);
+
+   /**
+    * Adds the contributions of the active presynaptic neurons of one batch element to dW,
+    * using the active list that the presynaptic layer's publisher keeps for sparse layers.
+    * For shared weights, the entries are grouped by kernel, so that each thread updates
+    * whole kernels, and each kernel sees its entries in the same order as the dense loop.
+    */
+   void update_dWFromActiveIndices(
+         int arborID,
+         int batchID,
+         float const *preLayerData,
+         float const *postLayerData,
+         SparseList<float>::Entry const *activeIndices,
+         long numActive);
+
    virtual float updateRule_dW(float pre, float post);
 
    void reduce_dW();
@@ -111,6 +164,13 @@ class HebbianUpdater : public BaseWeightUpdater {
 
    void reduceAcrossBatch(int arborID);
 
+   /**
+    * Starts a nonblocking in-place sum of the buffer over the communicator, in chunks of
+    * mDWReduceChunkSize values, appending the requests to mDeltaWeightsReduceRequests.
+    */
+   template <typename T>
+   void startReduction(T *buffer, std::size_t count, MPI_Datatype datatype, MPI_Comm comm);
+
    void blockingNormalize_dW();
 
    void wait_dWReduceRequests();
@@ -146,6 +206,7 @@ class HebbianUpdater : public BaseWeightUpdater {
    float mDWMaxDecayInterval          = 0.0f;
    bool mNormalizeDw                  = true;
    bool mCombine_dWWithWFlag          = false;
+   int mDWReduceChunkSize             = 0;
    bool mWriteCompressedCheckpoints   = false;
    bool mInitializeFromCheckpointFlag = false;
 
@@ -166,6 +227,17 @@ class HebbianUpdater : public BaseWeightUpdater {
    // m_dWReduceRequests as the signal to blockingNormalize_dW because the
    // requests are not created if there is only a single MPI processes.
    std::vector<ConnectionData *> mClones;
+
+   // Used by update_dWFromActiveIndices() to group active neurons by kernel: the extended
+   // indices of kernel k's active neurons are mKernelActiveNeurons[mKernelActiveStarts[k]]
+   // through mKernelActiveNeurons[mKernelActiveStarts[k + 1] - 1].
+   std::vector<int> mKernelActiveStarts;
+   std::vector<int> mKernelActiveNeurons;
+
+   // Thread-private copies of one arbor's dW and activation counts, allocated only if
+   // update_dWWithThreadShards() is used.
+   std::vector<std::vector<float>> mThreadDeltaWeights;
+   std::vector<std::vector<long>> mThreadNumKernelActivations;
 };
 
 } // namespace PV
@@ -0,0 +1,185 @@
+#include "delivery/accumulate_kernels.hpp"
+#include "utils/PVLog.hpp"
+
+#include <cmath>
+#include <vector>
+
+using PV::AccumulateKernels;
+using PV::AccumulateKernelVariant;
+
+// The vectorized kernels use fused multiply-add and sum in a different order than the scalar
+// kernels, so results may differ by round-off.
+float const tolerance = 1.0e-5f;
+
+float testValue(int k, int seed) { return (float)((k * 37 + seed * 11) % 101 - 50) / 50.0f; }
+
+// Tests every row width from 1 to 64, with every starting offset from 0 to 15 so that
+// unaligned and masked loads are exercised.
+void testAxpy(AccumulateKernels const *kernels, AccumulateKernels const *reference) {
+   int const maxWidth = 64;
+   for (int width = 1; width <= maxWidth; width++) {
+      for (int offset = 0; offset < 16; offset++) {
+         std::vector<float> w(maxWidth + 32), v(maxWidth + 32), vReference(maxWidth + 32);
+         for (std::size_t k = 0; k < w.size(); k++) {
+            w[k]          = testValue((int)k, 1);
+            v[k]          = testValue((int)k, 2);
+            vReference[k] = v[k];
+         }
+         float const a = 0.75f;
+         kernels->axpy(width, a, &w[offset], &v[offset]);
+         reference->axpy(width, a, &w[offset], &vReference[offset]);
+         for (std::size_t k = 0; k < v.size(); k++) {
+            bool inRow = (int)k >= offset and (int)k < offset + width;
+            FatalIf(
+                  inRow ? std::fabs(v[k] - vReference[k]) > tolerance : v[k] != vReference[k],
+                  "%s axpy, width %d, offset %d: index %d is %f instead of %f.\n",
+                  kernels->name,
+                  width,
+                  offset,
+                  (int)k,
+                  (double)v[k],
+                  (double)vReference[k]);
+         }
+      }
+   }
+}
+
+// Adding is exact, so every variant must agree with the scalar kernel exactly.
+void testAdd(AccumulateKernels const *kernels, AccumulateKernels const *reference) {
+   int const maxWidth = 64;
+   for (int width = 1; width <= maxWidth; width++) {
+      for (int offset = 0; offset < 16; offset++) {
+         std::vector<float> w(maxWidth + 32), v(maxWidth + 32), vReference(maxWidth + 32);
+         for (std::size_t k = 0; k < w.size(); k++) {
+            w[k]          = testValue((int)k, 1);
+            v[k]          = testValue((int)k, 2);
+            vReference[k] = v[k];
+         }
+         kernels->add(width, &w[offset], &v[offset]);
+         reference->add(width, &w[offset], &vReference[offset]);
+         for (std::size_t k = 0; k < v.size(); k++) {
+            float expected = vReference[k];
+            if ((int)k >= offset and (int)k < offset + width) {
+               FatalIf(
+                     expected != testValue((int)k, 2) + w[k],
+                     "scalar add, width %d, offset %d: index %d is %f instead of %f.\n",
+                     width,
+                     offset,
+                     (int)k,
+                     (double)expected,
+                     (double)(testValue((int)k, 2) + w[k]));
+            }
+            FatalIf(
+                  v[k] != expected,
+                  "%s add, width %d, offset %d: index %d is %f instead of %f.\n",
+                  kernels->name,
+                  width,
+                  offset,
+                  (int)k,
+                  (double)v[k],
+                  (double)expected);
+         }
+      }
+   }
+}
+
+void testDot(AccumulateKernels const *kernels, AccumulateKernels const *reference) {
+   int const maxWidth = 64;
+   for (int width = 1; width <= maxWidth; width++) {
+      for (int offset = 0; offset < 16; offset++) {
+         std::vector<float> a(maxWidth + 32), w(maxWidth + 32);
+         for (std::size_t k = 0; k < w.size(); k++) {
+            a[k] = testValue((int)k, 3);
+            w[k] = testValue((int)k, 4);
+         }
+         float dot         = kernels->dot(width, &a[offset], &w[offset]);
+         float dotExpected = reference->dot(width, &a[offset], &w[offset]);
+         FatalIf(
+               std::fabs(dot - dotExpected) > tolerance * width,
+               "%s dot, width %d, offset %d: result is %f instead of %f.\n",
+               kernels->name,
+               width,
+               offset,
+               (double)dot,
+               (double)dotExpected);
+      }
+   }
+}
+
+// Tests matrix sizes around the register-block sizes of the vectorized kernels, with leading
+// dimensions larger than the matrix widths, and with k both smaller and larger than the
+// k-blocking size.
+void testGemm(AccumulateKernels const *kernels, AccumulateKernels const *reference) {
+   int const mValues[] = {1, 3, 4, 5, 8, 9, 17};
+   int const nValues[] = {1, 7, 15, 16, 17, 31, 32, 33, 64, 70};
+   int const kValues[] = {1, 9, 300};
+   float const alpha   = 0.5f;
+   for (int m : mValues) {
+      for (int n : nValues) {
+         for (int k : kValues) {
+            int const lda = k + 3;
+            int const ldb = n + 5;
+            int const ldc = n + 2;
+            std::vector<float> a(m * lda), b(k * ldb), c(m * ldc), cReference(m * ldc);
+            for (std::size_t i = 0; i < a.size(); i++) {
+               a[i] = testValue((int)i, 5);
+            }
+            for (std::size_t i = 0; i < b.size(); i++) {
+               b[i] = testValue((int)i, 6);
+            }
+            for (std::size_t i = 0; i < c.size(); i++) {
+               c[i]          = testValue((int)i, 7);
+               cReference[i] = c[i];
+            }
+            kernels->gemm(m, n, k, alpha, a.data(), lda, b.data(), ldb, c.data(), ldc);
+            reference->gemm(m, n, k, alpha, a.data(), lda, b.data(), ldb, cReference.data(), ldc);
+            for (int i = 0; i < m; i++) {
+               for (int j = 0; j < ldc; j++) {
+                  float observed = c[i * ldc + j];
+                  float expected = cReference[i * ldc + j];
+                  FatalIf(
+                        j < n ? std::fabs(observed - expected) > tolerance * k
+                              : observed != expected,
+                        "%s gemm, m=%d, n=%d, k=%d: C(%d,%d) is %f instead of %f.\n",
+                        kernels->name,
+                        m,
+                        n,
+                        k,
+                        i,
+                        j,
+                        (double)observed,
+                        (double)expected);
+               }
+            }
+         }
+      }
+   }
+}
+
+int main(int argc, char *argv[]) {
+   AccumulateKernels const *scalar = PV::getAccumulateKernels(PV::ACCUMULATE_KERNEL_SCALAR);
+   FatalIf(scalar == nullptr, "The scalar accumulate kernels must always be available.\n");
+
+   for (int v = 0; v < PV::ACCUMULATE_KERNEL_NUM_VARIANTS; v++) {
+      AccumulateKernels const *kernels = PV::getAccumulateKernels((AccumulateKernelVariant)v);
+      if (kernels == nullptr) {
+         InfoLog() << "Accumulate kernel variant " << v << " is not supported on this CPU.\n";
+         continue;
+      }
+      testAxpy(kernels, scalar);
+      testAdd(kernels, scalar);
+      testDot(kernels, scalar);
+      testGemm(kernels, scalar);
+      InfoLog() << "Accumulate kernel variant \"" << kernels->name << "\" passed.\n";
+   }
+
+   AccumulateKernels const &selected = PV::getAccumulateKernels();
+   FatalIf(
+         selected.axpy == nullptr or selected.add == nullptr or selected.dot == nullptr
+               or selected.gemm == nullptr,
+         "The selected accumulate kernels \"%s\" are incomplete.\n",
+         selected.name);
+   InfoLog() << "Selected accumulate kernels are \"" << selected.name << "\".\n";
+   InfoLog() << "Test passed.\n";
+   return EXIT_SUCCESS;
+}
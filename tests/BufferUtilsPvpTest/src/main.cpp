@@ -1,3 +1,4 @@
+#include "io/MappedPvpFile.hpp"
 #include "structures/Buffer.hpp"
 #include "structures/SparseList.hpp"
 #include "utils/BufferUtilsPvp.hpp"
@@ -262,6 +263,55 @@ void testReadFromSparseBinaryPvp() {
       }
    }
 }
+// Reads every frame of the file with both MappedPvpFile::readFrame() and
+// BufferUtils::readActivityFromPvp(), and compares the results.
+void testMappedFile(const char *fName) {
+   PV::MappedPvpFile mappedFile(fName);
+   int const numFrames = mappedFile.getNumFrames();
+   for (int frame = 0; frame < numFrames; ++frame) {
+      Buffer<float> mappedBuffer;
+      double mappedTime = mappedFile.readFrame(frame, &mappedBuffer);
+      Buffer<float> streamBuffer;
+      double streamTime =
+            BufferUtils::readActivityFromPvp<float>(fName, &streamBuffer, frame, nullptr);
+      FatalIf(
+            mappedTime != streamTime,
+            "%s frame %d: expected time %f, found %f.\n",
+            fName,
+            frame,
+            streamTime,
+            mappedTime);
+      FatalIf(
+            mappedBuffer.getWidth() != streamBuffer.getWidth()
+                  or mappedBuffer.getHeight() != streamBuffer.getHeight()
+                  or mappedBuffer.getFeatures() != streamBuffer.getFeatures(),
+            "%s frame %d: dimensions do not match.\n",
+            fName,
+            frame);
+      FatalIf(
+            mappedBuffer.asVector() != streamBuffer.asVector(),
+            "%s frame %d: values do not match.\n",
+            fName,
+            frame);
+   }
+
+   // Frame indices past the end of the file wrap around to the beginning.
+   Buffer<float> firstBuffer, wrappedBuffer;
+   double firstTime   = mappedFile.readFrame(0, &firstBuffer);
+   double wrappedTime = mappedFile.readFrame(numFrames, &wrappedBuffer);
+   FatalIf(
+         wrappedTime != firstTime or wrappedBuffer.asVector() != firstBuffer.asVector(),
+         "%s: frame %d does not wrap around to frame 0.\n",
+         fName,
+         numFrames);
+}
+
+void testReadFromMappedPvp() {
+   testMappedFile("input/input_8x4x2_x3.pvp");
+   testMappedFile("input/sparse_5x5x1_x5.pvp");
+   testMappedFile("input/binary_3x2x1_x3.pvp");
+}
+
 int main(int argc, char **argv) {
 
    InfoLog() << "Testing BufferUtils:readDenseFromPvp(): ";
@@ -284,6 +334,10 @@ int main(int argc, char **argv) {
    testReadFromSparseBinaryPvp();
    InfoLog() << "Completed.\n";
 
+   InfoLog() << "Testing MappedPvpFile::readFrame(): ";
+   testReadFromMappedPvp();
+   InfoLog() << "Completed.\n";
+
    InfoLog() << "BufferUtils tests completed successfully!\n";
    return EXIT_SUCCESS;
 }
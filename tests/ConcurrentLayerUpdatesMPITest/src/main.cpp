@@ -0,0 +1,58 @@
+/*
+ * main.cpp
+ *
+ * Runs a column whose phase 1 mixes layers that make MPI calls while updating with layers that
+ * do not, once with concurrentLayerUpdates off and once with it on, and checks that the layers
+ * agree. Under several MPI processes, the concurrent run deadlocks or corrupts the exchanges if
+ * the layers that make MPI calls are updated on other threads or in a different order on
+ * different processes.
+ */
+
+#include "ColumnArchive.hpp"
+#include <columns/buildandrun.hpp>
+
+int main(int argc, char *argv[]) {
+   PV_Init initObj(&argc, &argv, false /*allowUnrecognizedArguments*/);
+   if (initObj.getParams() == nullptr) {
+      initObj.setParams("input/ConcurrentLayerUpdatesMPITest.params");
+   }
+
+   // Use the number of threads given on the command line, but at least two, so that the
+   // concurrent run updates layers on more than one thread.
+   Configuration::IntOptional threadsArg = initObj.getIntOptionalArgument("NumThreads");
+#ifdef PV_USE_OPENMP_THREADS
+   if (threadsArg.mUseDefault or threadsArg.mValue < 2) {
+      threadsArg.mUseDefault = false;
+      threadsArg.mValue      = 2;
+   }
+#endif // PV_USE_OPENMP_THREADS
+   initObj.setIntOptionalArgument("NumThreads", threadsArg);
+
+   ParameterGroup *columnGroup = initObj.getParams()->group("column");
+   FatalIf(columnGroup == nullptr, "The params file has no group named \"column\".\n");
+
+   // A layer updated on one of the concurrent threads runs its delivery with a single thread,
+   // so its input is summed in a different order than in the serial run and the activities may
+   // differ by round-off.
+   float const layerTolerance = 1.0e-6f;
+
+   columnGroup->setValue("concurrentLayerUpdates", 0.0);
+   HyPerCol *hc = build(&initObj);
+   FatalIf(hc->run() != PV_SUCCESS, "Run with concurrentLayerUpdates off failed.\n");
+   ColumnArchive serialArchive(hc, layerTolerance, 0.0f /*connTolerance*/);
+   delete hc;
+
+   columnGroup->setValue("concurrentLayerUpdates", 1.0);
+   hc = build(&initObj);
+   FatalIf(hc->run() != PV_SUCCESS, "Run with concurrentLayerUpdates on failed.\n");
+   ColumnArchive concurrentArchive(hc, layerTolerance, 0.0f /*connTolerance*/);
+   delete hc;
+
+   FatalIf(
+         concurrentArchive != serialArchive,
+         "The layers with concurrentLayerUpdates on differ from those with it off.\n");
+   if (initObj.getWorldRank() == 0) {
+      InfoLog() << "Test passed.\n";
+   }
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,127 @@
+#include "columns/Random.hpp"
+#include "columns/RandomSeed.hpp"
+#include "utils/PVLog.hpp"
+#include "utils/philox.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using PV::Philox4x32;
+using PV::Random;
+
+// The known-answer vectors for Philox4x32-10 from the Random123 distribution.
+void testKnownAnswers() {
+   std::uint32_t const counters[3][4] = {{0U, 0U, 0U, 0U},
+                                         {0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU},
+                                         {0x243f6a88U, 0x85a308d3U, 0x13198a2eU, 0x03707344U}};
+   std::uint32_t const keys[3][2]     = {
+         {0U, 0U}, {0xffffffffU, 0xffffffffU}, {0xa4093822U, 0x299f31d0U}};
+   std::uint32_t const expected[3][4] = {{0x6627e8d5U, 0xe169c58dU, 0xbc57ac4cU, 0x9b00dbd8U},
+                                         {0x408f276dU, 0x41c83b0eU, 0xa20bc7c6U, 0x6d5451fdU},
+                                         {0xd16cfe09U, 0x94fdccebU, 0x5001e420U, 0x24126ea1U}};
+   for (int n = 0; n < 3; n++) {
+      std::uint32_t out[4];
+      Philox4x32::generate(counters[n], keys[n], out);
+      for (int k = 0; k < 4; k++) {
+         FatalIf(
+               out[k] != expected[n][k],
+               "Known-answer vector %d, word %d: 0x%08x instead of 0x%08x.\n",
+               n,
+               k,
+               (unsigned)out[k],
+               (unsigned)expected[n][k]);
+      }
+   }
+
+   // The blocked version must agree with the single-block version, including for a partial
+   // group at the end.
+   int const numBlocks = 37;
+   std::vector<std::uint32_t> blocks(4 * numBlocks);
+   Philox4x32::generateBlocks(5U, 1U, 2U, 3U, keys[2], numBlocks, blocks.data());
+   for (int j = 0; j < numBlocks; j++) {
+      std::uint32_t counter[4] = {5U + (std::uint32_t)j, 1U, 2U, 3U};
+      std::uint32_t out[4];
+      Philox4x32::generate(counter, keys[2], out);
+      for (int k = 0; k < 4; k++) {
+         FatalIf(
+               blocks[4 * j + k] != out[k],
+               "generateBlocks: block %d, word %d disagrees with generate().\n",
+               j,
+               k);
+      }
+   }
+}
+
+// A stream must not depend on how it is divided into calls, or on what was generated before.
+void testStreams() {
+   Random random(4);
+   int const length = 1000;
+   std::vector<unsigned int> whole(length);
+   random.counterRandomUInt(whole.data(), 2, 17L, 3U, 0U, length);
+
+   // Generating other streams, and using the Tausworthe generator, must not change anything.
+   std::vector<unsigned int> other(length);
+   random.counterRandomUInt(other.data(), 1, 17L, 3U, 0U, length);
+   random.uniformRandom(2);
+   std::vector<unsigned int> pieces(length);
+   int const pieceLengths[] = {1, 2, 3, 5, 7, 300, 1};
+   int start                = 0;
+   int p                    = 0;
+   while (start < length) {
+      int const n = std::min(pieceLengths[p % 7], length - start);
+      random.counterRandomUInt(&pieces[start], 2, 17L, 3U, (unsigned int)start, n);
+      start += n;
+      p++;
+   }
+   for (int k = 0; k < length; k++) {
+      FatalIf(
+            pieces[k] != whole[k],
+            "Number %d of the stream is %u when generated in pieces, instead of %u.\n",
+            k,
+            pieces[k],
+            whole[k]);
+   }
+
+   // Different indices, timesteps, and substreams must give different streams.
+   std::vector<unsigned int> variants[3];
+   for (auto &v : variants) {
+      v.resize(length);
+   }
+   random.counterRandomUInt(variants[0].data(), 1, 17L, 3U, 0U, length);
+   random.counterRandomUInt(variants[1].data(), 2, 18L, 3U, 0U, length);
+   random.counterRandomUInt(variants[2].data(), 2, 17L, 4U, 0U, length);
+   for (int n = 0; n < 3; n++) {
+      int numEqual = 0;
+      for (int k = 0; k < length; k++) {
+         numEqual += variants[n][k] == whole[k];
+      }
+      FatalIf(numEqual > 1, "Variant %d has %d numbers in common with the stream.\n", n, numEqual);
+   }
+
+   // The uniform numbers must be the scaled integers, and have roughly the right mean.
+   std::vector<float> uniform(length);
+   random.counterUniformRandom(uniform.data(), 2, 17L, 3U, 0U, length);
+   double sum = 0.0;
+   for (int k = 0; k < length; k++) {
+      float const expected = (float)whole[k] / (float)Random::randomUIntMax();
+      FatalIf(
+            uniform[k] != expected,
+            "Uniform number %d is %f instead of %f.\n",
+            k,
+            (double)uniform[k],
+            (double)expected);
+      sum += (double)uniform[k];
+   }
+   double const mean = sum / (double)length;
+   // The standard deviation of the mean is 1/sqrt(12 * 1000), about 0.009.
+   FatalIf(mean < 0.45 or mean > 0.55, "The mean of the uniform numbers is %f.\n", mean);
+}
+
+int main(int argc, char *argv[]) {
+   PV::RandomSeed::instance()->initialize(1234567890U);
+   testKnownAnswers();
+   testStreams();
+   InfoLog() << "Test passed.\n";
+   return EXIT_SUCCESS;
+}
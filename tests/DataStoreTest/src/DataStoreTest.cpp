@@ -5,6 +5,7 @@
 
 #include <columns/DataStore.hpp>
 #include <utils/PVLog.hpp>
+#include <vector>
 
 const int NUM_BUFFERS = 2;
 const int NUM_ITEMS   = 10;
@@ -12,6 +13,9 @@ const int NUM_LEVELS  = 4;
 
 float correctData(int bufferIndex, int itemIndex, int levelIndex);
 double correctTime(int bufferIndex, int levelIndex);
+void testCompactActiveIndices(int numRows, int rowLength, int rowStride, int firstIndex);
+void testSparseUpdateActiveIndices();
+void testCompactLevels();
 
 int main(int argc, char *argv[]) {
    PV::DataStore store(NUM_BUFFERS, NUM_ITEMS, NUM_LEVELS, false /*store is not sparse*/);
@@ -71,6 +75,15 @@ int main(int argc, char *argv[]) {
       store.newLevelIndex(); // Rotate.
    }
 
+   // A single row, and a region of rows inside a larger buffer, each large enough that
+   // compactActiveIndices() uses all the threads.
+   testCompactActiveIndices(1, 100000, 100000, 0);
+   testCompactActiveIndices(300, 400, 412, 2478);
+   // A region small enough to be compacted serially.
+   testCompactActiveIndices(5, 7, 9, 11);
+   testSparseUpdateActiveIndices();
+   testCompactLevels();
+
    return EXIT_SUCCESS;
 }
 
@@ -81,3 +94,191 @@ float correctData(int bufferIndex, int itemIndex, int levelIndex) {
 double correctTime(int bufferIndex, int levelIndex) {
    return (double)(200 + bufferIndex + NUM_BUFFERS * (levelIndex * NUM_ITEMS));
 }
+
+// Roughly one value in seven is nonzero.
+float sparseData(int index) {
+   return (index * 2654435761u) % 7u == 0u ? (float)(index % 13) : 0.0f;
+}
+
+void testCompactActiveIndices(int numRows, int rowLength, int rowStride, int firstIndex) {
+   std::vector<float> data(firstIndex + numRows * rowStride);
+   for (int k = 0; k < (int)data.size(); k++) {
+      data[k] = sparseData(k);
+   }
+   std::vector<PV::SparseList<float>::Entry> activeIndices(numRows * rowLength);
+   long numActive = PV::DataStore::compactActiveIndices(
+         data.data(), numRows, rowLength, rowStride, firstIndex, activeIndices.data());
+
+   long n = 0L;
+   for (int row = 0; row < numRows; row++) {
+      int const rowStart = firstIndex + row * rowStride;
+      for (int k = rowStart; k < rowStart + rowLength; k++) {
+         if (data[k] == 0.0f) {
+            continue;
+         }
+         FatalIf(
+               n >= numActive,
+               "compactActiveIndices found %ld active values; there are more.\n",
+               numActive);
+         FatalIf(
+               (int)activeIndices[n].index != k or activeIndices[n].value != data[k],
+               "compactActiveIndices entry %ld is (%d, %f) instead of (%d, %f).\n",
+               n,
+               (int)activeIndices[n].index,
+               (double)activeIndices[n].value,
+               k,
+               (double)data[k]);
+         n++;
+      }
+   }
+   FatalIf(
+         n != numActive,
+         "compactActiveIndices found %ld active values instead of %ld.\n",
+         numActive,
+         n);
+}
+
+void testSparseUpdateActiveIndices() {
+   PV::DataStore store(NUM_BUFFERS, NUM_ITEMS, NUM_LEVELS, true /*store is sparse*/);
+   for (int b = 0; b < NUM_BUFFERS; b++) {
+      for (int k = 0; k < NUM_ITEMS; k++) {
+         store.buffer(b, 1)[k] = sparseData(b * NUM_ITEMS + k);
+      }
+      store.markActiveIndicesOutOfSync(b, 1);
+      store.updateActiveIndices(b, 1);
+      long n = 0L;
+      for (int k = 0; k < NUM_ITEMS; k++) {
+         float const a = store.buffer(b, 1)[k];
+         if (a != 0.0f) {
+            auto const &entry = store.activeIndicesBuffer(b, 1)[n];
+            FatalIf(
+                  (int)entry.index != k or entry.value != a,
+                  "updateActiveIndices for buffer %d: entry %ld is wrong.\n",
+                  b,
+                  n);
+            n++;
+         }
+      }
+      FatalIf(
+            *store.numActiveBuffer(b, 1) != n,
+            "updateActiveIndices for buffer %d found %ld active values instead of %ld.\n",
+            b,
+            *store.numActiveBuffer(b, 1),
+            n);
+   }
+}
+
+// Checks that every level of the compact store has the same data and active indices as the
+// same level of the store that is not compact.
+void compareLevels(PV::DataStore &compact, PV::DataStore &reference, int step) {
+   PVLayerLoc loc;
+   loc.nbatch = NUM_BUFFERS;
+   for (int level = 0; level < NUM_LEVELS; level++) {
+      PVLayerCube compactCube   = compact.createCube(loc, level);
+      PVLayerCube referenceCube = reference.createCube(loc, level);
+      for (int k = 0; k < NUM_BUFFERS * NUM_ITEMS; k++) {
+         FatalIf(
+               compactCube.data[k] != referenceCube.data[k],
+               "Compact store, step %d, level %d: item %d is %f instead of %f.\n",
+               step,
+               level,
+               k,
+               (double)compactCube.data[k],
+               (double)referenceCube.data[k]);
+      }
+      for (int b = 0; b < NUM_BUFFERS; b++) {
+         long const numActive = referenceCube.numActive[b];
+         FatalIf(
+               compactCube.numActive[b] != numActive,
+               "Compact store, step %d, level %d, buffer %d: %ld active values instead of %ld.\n",
+               step,
+               level,
+               b,
+               compactCube.numActive[b],
+               numActive);
+         auto const *compactEntries =
+               (PV::SparseList<float>::Entry const *)compactCube.activeIndices + b * NUM_ITEMS;
+         auto const *referenceEntries =
+               (PV::SparseList<float>::Entry const *)referenceCube.activeIndices + b * NUM_ITEMS;
+         // activeList() reads the level's own list, without the dense copy.
+         auto const *compactList = compact.activeList(b, level);
+         for (long n = 0L; n < numActive; n++) {
+            FatalIf(
+                  compactEntries[n].index != referenceEntries[n].index
+                        or compactEntries[n].value != referenceEntries[n].value,
+                  "Compact store, step %d, level %d, buffer %d: entry %ld is wrong.\n",
+                  step,
+                  level,
+                  b,
+                  n);
+            FatalIf(
+                  compactList[n].index != referenceEntries[n].index
+                        or compactList[n].value != referenceEntries[n].value,
+                  "Compact store, step %d, level %d, buffer %d: list entry %ld is wrong.\n",
+                  step,
+                  level,
+                  b,
+                  n);
+         }
+      }
+   }
+}
+
+void testCompactLevels() {
+   PV::DataStore compact(
+         NUM_BUFFERS,
+         NUM_ITEMS,
+         NUM_LEVELS,
+         true /*store is sparse*/,
+         nullptr /*no shared buffer*/,
+         true /*compact levels*/);
+   PV::DataStore reference(NUM_BUFFERS, NUM_ITEMS, NUM_LEVELS, true /*store is sparse*/);
+   FatalIf(!compact.hasCompactLevels(), "The compact store does not have compact levels.\n");
+   FatalIf(reference.hasCompactLevels(), "The reference store has compact levels.\n");
+
+   // Every level of both stores starts out zero. Write the current level at each step, as
+   // publishing does, so that each level's dense copy is made from several different lists.
+   for (int step = 0; step < 3 * NUM_LEVELS; step++) {
+      for (int b = 0; b < NUM_BUFFERS; b++) {
+         for (int k = 0; k < NUM_ITEMS; k++) {
+            float const a          = sparseData((step * NUM_BUFFERS + b) * NUM_ITEMS + 3 * k);
+            compact.buffer(b)[k]   = a;
+            reference.buffer(b)[k] = a;
+         }
+         compact.markActiveIndicesOutOfSync(b, 0);
+         compact.updateActiveIndices(b, 0);
+         reference.markActiveIndicesOutOfSync(b, 0);
+         reference.updateActiveIndices(b, 0);
+      }
+      // The levels have rotated since the last comparison, so every copy is stale. Several
+      // threads asking for the same levels at once, as concurrent layer updates do, must all
+      // see the refreshed copies.
+#ifdef PV_USE_OPENMP_THREADS
+#pragma omp parallel for schedule(static, 1)
+#endif // PV_USE_OPENMP_THREADS
+      for (int t = 0; t < 4; t++) {
+         compareLevels(compact, reference, step);
+      }
+      compact.newLevelIndex();
+      reference.newLevelIndex();
+   }
+
+   // Writing into an older level's copy, as reading a checkpoint does, must change the level.
+   for (int b = 0; b < NUM_BUFFERS; b++) {
+      for (int k = 0; k < NUM_ITEMS; k++) {
+         float const a             = sparseData(b * NUM_ITEMS + 5 * k + 1);
+         compact.buffer(b, 2)[k]   = a;
+         reference.buffer(b, 2)[k] = a;
+         compact.buffer(b, 0)[k]   = a;
+         reference.buffer(b, 0)[k] = a;
+      }
+      for (int level = 0; level < NUM_LEVELS; level++) {
+         compact.markActiveIndicesOutOfSync(b, level);
+         compact.updateActiveIndices(b, level);
+         reference.markActiveIndicesOutOfSync(b, level);
+         reference.updateActiveIndices(b, level);
+      }
+   }
+   compact.releaseLevelCopies();
+   compareLevels(compact, reference, -1);
+}
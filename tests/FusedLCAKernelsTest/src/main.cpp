@@ -0,0 +1,267 @@
+#include "columns/DataStore.hpp"
+#include "layers/fused_lca_kernels.hpp"
+#include "layers/updateStateFunctions.h"
+#include "utils/PVLog.hpp"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+using PV::AccumulateKernelVariant;
+using PV::FusedLCAArgs;
+using PV::FusedLCARule;
+using PV::SparseList;
+
+// The fused kernel may use fused multiply-add where the separate passes do not, so results may
+// differ by round-off.
+float const tolerance = 1.0e-5f;
+
+float testValue(int k, int seed) { return (float)((k * 37 + seed * 11) % 101 - 50) / 50.0f; }
+
+char const *ruleName(FusedLCARule rule) {
+   switch (rule) {
+      case PV::FUSED_LCA_HYPERLCA: return "HyPerLCALayer";
+      case PV::FUSED_LCA_MOMENTUM: return "MomentumLCALayer";
+      case PV::FUSED_LCA_ISTA: return "ISTALayer";
+      default: return "unknown rule";
+   }
+}
+
+// A soft threshold at +/-0.25 with a jump of 0.1, as an ANNLayer with VThresh = 0.25 and
+// AShift = 0.15 would have.
+std::vector<float> verticesV = {-0.25f, -0.25f, 0.25f, 0.25f};
+std::vector<float> verticesA = {-0.1f, 0.0f, 0.0f, 0.1f};
+std::vector<float> slopes    = {1.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+
+struct LayerState {
+   std::vector<float> V;
+   std::vector<float> activity;
+   std::vector<float> prevDrive;
+};
+
+void compare(
+      std::vector<float> const &observed,
+      std::vector<float> const &expected,
+      std::string const &description,
+      char const *bufferName) {
+   for (std::size_t k = 0; k < expected.size(); k++) {
+      FatalIf(
+            std::fabs(observed[k] - expected[k]) > tolerance,
+            "%s: %s[%d] is %f instead of %f.\n",
+            description.c_str(),
+            bufferName,
+            (int)k,
+            (double)observed[k],
+            (double)expected[k]);
+   }
+}
+
+// Runs several timesteps of the rule with the fused kernel and with the separate passes in
+// updateStateFunctions.h, so that the activity of one timestep feeds into the next, and checks
+// that V, the activity, and the active list agree.
+void testRule(FusedLCARule rule, int numChannels, AccumulateKernelVariant variant) {
+   PVLayerLoc loc;
+   loc.nbatch            = 2;
+   loc.nx                = 13;
+   loc.ny                = 5;
+   loc.nf                = 3;
+   loc.halo.lt           = 2;
+   loc.halo.rt           = 1;
+   loc.halo.dn           = 2;
+   loc.halo.up           = 1;
+   int const numNeurons  = loc.nx * loc.ny * loc.nf;
+   int const rowStride   = (loc.nx + loc.halo.lt + loc.halo.rt) * loc.nf;
+   int const numExtended = (loc.ny + loc.halo.dn + loc.halo.up) * rowStride;
+   int const firstIndex  = loc.halo.up * rowStride + loc.halo.lt * loc.nf;
+
+   std::string description = std::string(ruleName(rule)) + ", variant "
+                             + std::to_string((int)variant) + ", "
+                             + std::to_string(numChannels) + " channel(s)";
+
+   LayerState fused, reference;
+   fused.V.resize(loc.nbatch * numNeurons);
+   fused.activity.resize(loc.nbatch * numExtended);
+   fused.prevDrive.resize(loc.nbatch * numNeurons);
+   for (std::size_t k = 0; k < fused.V.size(); k++) {
+      fused.V[k]         = 0.5f * testValue((int)k, 1);
+      fused.prevDrive[k] = 0.1f * testValue((int)k, 2);
+   }
+   for (std::size_t k = 0; k < fused.activity.size(); k++) {
+      // Nonzero halo values check that the halo is neither written nor counted as active.
+      fused.activity[k] = 0.2f * testValue((int)k, 3);
+   }
+   reference = fused;
+
+   std::vector<double> dtAdapt = {0.5, 0.25};
+   float const tau             = 4.0f;
+   float const selfInteract    = 1.0f;
+   float const momentumRate    = 0.5f;
+   float const VThresh         = 0.25f;
+   std::vector<SparseList<float>::Entry> activeIndices(loc.nbatch * numNeurons);
+   std::vector<long> numActive(loc.nbatch);
+
+   for (int t = 0; t < 3; t++) {
+      std::vector<float> GSyn(numChannels * loc.nbatch * numNeurons);
+      for (std::size_t k = 0; k < GSyn.size(); k++) {
+         GSyn[k] = testValue((int)k, 4 + t);
+      }
+
+      FusedLCAArgs args;
+      args.rule          = rule;
+      args.loc           = &loc;
+      args.numChannels   = numChannels;
+      args.V             = fused.V.data();
+      args.GSynHead      = GSyn.data();
+      args.activity      = fused.activity.data();
+      args.prevDrive     = rule == PV::FUSED_LCA_MOMENTUM ? fused.prevDrive.data() : nullptr;
+      args.numVertices   = (int)verticesV.size();
+      args.verticesV     = verticesV.data();
+      args.verticesA     = verticesA.data();
+      args.slopes        = slopes.data();
+      args.dtAdapt       = dtAdapt.data();
+      args.tau           = tau;
+      args.selfInteract  = selfInteract;
+      args.momentumRate  = momentumRate;
+      args.VThresh       = VThresh;
+      args.activeIndices = activeIndices.data();
+      args.numActive     = numActive.data();
+      PV::fusedLCAUpdate(args, variant);
+
+      switch (rule) {
+         case PV::FUSED_LCA_HYPERLCA:
+            updateV_HyPerLCALayer(
+                  loc.nbatch,
+                  numNeurons,
+                  numChannels,
+                  reference.V.data(),
+                  GSyn.data(),
+                  reference.activity.data(),
+                  (int)verticesV.size(),
+                  verticesV.data(),
+                  verticesA.data(),
+                  slopes.data(),
+                  dtAdapt.data(),
+                  tau,
+                  selfInteract,
+                  loc.nx,
+                  loc.ny,
+                  loc.nf,
+                  loc.halo.lt,
+                  loc.halo.rt,
+                  loc.halo.dn,
+                  loc.halo.up);
+            break;
+         case PV::FUSED_LCA_MOMENTUM:
+            updateV_MomentumLCALayer(
+                  loc.nbatch,
+                  numNeurons,
+                  numChannels,
+                  reference.V.data(),
+                  GSyn.data(),
+                  reference.activity.data(),
+                  reference.prevDrive.data(),
+                  (int)verticesV.size(),
+                  verticesV.data(),
+                  verticesA.data(),
+                  slopes.data(),
+                  dtAdapt.data(),
+                  tau,
+                  momentumRate,
+                  selfInteract,
+                  loc.nx,
+                  loc.ny,
+                  loc.nf,
+                  loc.halo.lt,
+                  loc.halo.rt,
+                  loc.halo.dn,
+                  loc.halo.up);
+            break;
+         case PV::FUSED_LCA_ISTA:
+            updateV_ISTALayer(
+                  loc.nbatch,
+                  numNeurons,
+                  reference.V.data(),
+                  GSyn.data(),
+                  reference.activity.data(),
+                  VThresh,
+                  dtAdapt.data(),
+                  tau,
+                  loc.nx,
+                  loc.ny,
+                  loc.nf,
+                  loc.halo.lt,
+                  loc.halo.rt,
+                  loc.halo.dn,
+                  loc.halo.up,
+                  numChannels);
+            break;
+         default: Fatal() << "Unrecognized rule " << (int)rule << "\n";
+      }
+
+      std::string timestepDescription = description + ", timestep " + std::to_string(t);
+      compare(fused.V, reference.V, timestepDescription, "V");
+      compare(fused.activity, reference.activity, timestepDescription, "activity");
+      compare(fused.prevDrive, reference.prevDrive, timestepDescription, "prevDrive");
+
+      // The active list must be exactly what a search of the activity buffer would find.
+      std::vector<SparseList<float>::Entry> expectedIndices(numNeurons);
+      for (int b = 0; b < loc.nbatch; b++) {
+         long expectedCount = PV::DataStore::compactActiveIndices(
+               &fused.activity[b * numExtended],
+               loc.ny,
+               loc.nx * loc.nf,
+               rowStride,
+               firstIndex,
+               expectedIndices.data());
+         FatalIf(
+               numActive[b] != expectedCount,
+               "%s, batch element %d: %ld active neurons instead of %ld.\n",
+               timestepDescription.c_str(),
+               b,
+               numActive[b],
+               expectedCount);
+         // ISTALayer's activity is V, so every neuron is usually active.
+         FatalIf(
+               rule != PV::FUSED_LCA_ISTA
+                     and (expectedCount == 0L or expectedCount == (long)numNeurons),
+               "%s, batch element %d: the test values should make some but not all neurons "
+               "active.\n",
+               timestepDescription.c_str(),
+               b);
+         for (long n = 0; n < expectedCount; n++) {
+            SparseList<float>::Entry const &entry = activeIndices[b * numNeurons + n];
+            FatalIf(
+                  entry.index != expectedIndices[n].index
+                        or entry.value != expectedIndices[n].value,
+                  "%s, batch element %d: active entry %ld is (%u, %f) instead of (%u, %f).\n",
+                  timestepDescription.c_str(),
+                  b,
+                  n,
+                  (unsigned)entry.index,
+                  (double)entry.value,
+                  (unsigned)expectedIndices[n].index,
+                  (double)expectedIndices[n].value);
+         }
+      }
+   }
+}
+
+int main(int argc, char *argv[]) {
+   FusedLCARule const rules[] = {
+         PV::FUSED_LCA_HYPERLCA, PV::FUSED_LCA_MOMENTUM, PV::FUSED_LCA_ISTA};
+   for (int v = 0; v < PV::ACCUMULATE_KERNEL_NUM_VARIANTS; v++) {
+      AccumulateKernelVariant variant = (AccumulateKernelVariant)v;
+      if (PV::getAccumulateKernels(variant) == nullptr) {
+         InfoLog() << "Instruction set variant " << v << " is not supported on this CPU.\n";
+         continue;
+      }
+      for (FusedLCARule rule : rules) {
+         for (int numChannels = 1; numChannels <= 2; numChannels++) {
+            testRule(rule, numChannels, variant);
+         }
+      }
+      InfoLog() << "Instruction set variant " << v << " passed.\n";
+   }
+   InfoLog() << "Test passed.\n";
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,223 @@
+/*
+ * main.cpp for IncrementalCheckpointsTest
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Writes a series of checkpoints with checkpointWriteIncremental set, and checks that the files
+ *  of an entry registered as constant, and of entries whose data do not change, are hard links
+ *  shared by all the checkpoints that have not been deleted, while the files of an entry whose
+ *  data changes are written anew each time. One of the unchanged entries is a weight pvp file,
+ *  whose header has the time of the checkpoint that writes it.
+ */
+
+#include "checkpointing/CheckpointEntryWeightPvp.hpp"
+#include "checkpointing/Checkpointer.hpp"
+#include "columns/CommandLineArguments.hpp"
+#include "columns/Communicator.hpp"
+#include "components/Weights.hpp"
+#include "io/FileStream.hpp"
+#include "io/PVParams.hpp"
+#include "io/io.hpp"
+#include "utils/PVLog.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <vector>
+
+int checkLinkCount(std::string const &path, nlink_t expectedCount) {
+   struct stat pathStat;
+   int statResult = stat(path.c_str(), &pathStat);
+   if (statResult != 0) {
+      ErrorLog() << "stat " << path << " returned \"" << std::strerror(errno) << "\".\n";
+      return PV_FAILURE;
+   }
+   if (pathStat.st_nlink != expectedCount) {
+      ErrorLog() << path << " has " << pathStat.st_nlink << " links; expected " << expectedCount
+                 << ".\n";
+      return PV_FAILURE;
+   }
+   return PV_SUCCESS;
+}
+
+int checkContents(std::string const &path, std::vector<float> const &expected) {
+   std::vector<float> contents(expected.size());
+   PV::FileStream fileStream(path.c_str(), std::ios_base::in, false);
+   fileStream.read(contents.data(), (long)(contents.size() * sizeof(float)));
+   if (contents != expected) {
+      ErrorLog() << path << " does not have the expected contents.\n";
+      return PV_FAILURE;
+   }
+   return PV_SUCCESS;
+}
+
+PVLayerLoc setLayerLoc(PV::MPIBlock const *mpiBlock, int nx, int ny, int nf, int margin) {
+   PVLayerLoc loc;
+   loc.nbatch       = 1;
+   loc.nx           = nx;
+   loc.ny           = ny;
+   loc.nf           = nf;
+   loc.nbatchGlobal = mpiBlock->getGlobalBatchDimension();
+   loc.nxGlobal     = nx * mpiBlock->getGlobalNumColumns();
+   loc.nyGlobal     = ny * mpiBlock->getGlobalNumRows();
+   loc.kb0          = mpiBlock->getStartBatch() + mpiBlock->getBatchIndex();
+   loc.kx0          = nx * (mpiBlock->getStartColumn() + mpiBlock->getColumnIndex());
+   loc.ky0          = ny * (mpiBlock->getStartRow() + mpiBlock->getRowIndex());
+   loc.halo.lt      = margin;
+   loc.halo.rt      = margin;
+   loc.halo.dn      = margin;
+   loc.halo.up      = margin;
+   return loc;
+}
+
+int main(int argc, char *argv[]) {
+   // Initialize PetaVision environment
+   PV::CommandLineArguments arguments{argc, argv, false /*do not allow unrecognized arguments*/};
+   MPI_Init(&argc, &argv);
+   PV::Communicator *comm       = new PV::Communicator(&arguments);
+   PV::MPIBlock const *mpiBlock = comm->getLocalMPIBlock();
+
+   // Params file
+   PV::PVParams *params = new PV::PVParams("input/IncrementalCheckpointsTest.params", 1, comm);
+
+   // Create checkpointing directory and delete any existing files inside it.
+   char const *checkpointWriteDir = params->stringValue("checkpointer", "checkpointWriteDir");
+   FatalIf(
+         checkpointWriteDir == nullptr,
+         "Group \"checkpointer\" must have a checkpointWriteDir string parameter.\n");
+   std::string checkpointWriteDirectory(checkpointWriteDir);
+   ensureDirExists(mpiBlock, checkpointWriteDirectory.c_str());
+   if (mpiBlock->getRank() == 0) {
+      std::string rmcommand("rm -rf ");
+      rmcommand.append(checkpointWriteDirectory).append("/*");
+      InfoLog() << "Cleaning directory \"" << checkpointWriteDirectory << "\" with \"" << rmcommand
+                << "\".\n";
+      int rmstatus = system(rmcommand.c_str());
+      FatalIf(
+            rmstatus,
+            "Error executing \"%s\": status code was %d\n",
+            rmcommand.c_str(),
+            WEXITSTATUS(rmstatus));
+   }
+   FatalIf(
+         params->value("checkpointer", "checkpointWriteIncremental") == 0.0,
+         "Params file must set checkpointWriteIncremental to true.\n");
+   FatalIf(
+         params->value("checkpointer", "deleteOlderCheckpoints") == 0.0,
+         "Params file must set deleteOlderCheckpoints to true.\n");
+   int const numKept = params->valueInt("checkpointer", "numCheckpointsKept");
+
+   // Initialize Checkpointer object
+   PV::Checkpointer *checkpointer = new PV::Checkpointer("checkpointer", mpiBlock, &arguments);
+   checkpointer->ioParams(PV::PARAMS_IO_READ, params);
+   delete params;
+
+   std::vector<float> constantData(16);
+   std::vector<float> unchangedData(16);
+   std::vector<float> changingData(16);
+   for (std::size_t k = 0; k < constantData.size(); k++) {
+      constantData[k]  = (float)k;
+      unchangedData[k] = (float)(2 * k);
+   }
+   checkpointer->registerCheckpointData(
+         std::string("constant"),
+         std::string("data"),
+         constantData.data(),
+         constantData.size(),
+         true /*broadcast*/,
+         true /*constantEntireRun*/);
+   checkpointer->registerCheckpointData(
+         std::string("unchanged"),
+         std::string("data"),
+         unchangedData.data(),
+         unchangedData.size(),
+         true /*broadcast*/,
+         false /*constantEntireRun*/);
+   checkpointer->registerCheckpointData(
+         std::string("changing"),
+         std::string("data"),
+         changingData.data(),
+         changingData.size(),
+         true /*broadcast*/,
+         false /*constantEntireRun*/);
+
+   PVLayerLoc const preLoc  = setLayerLoc(mpiBlock, 4, 4, 2, 1);
+   PVLayerLoc const postLoc = setLayerLoc(mpiBlock, 4, 4, 3, 0);
+   PV::Weights unchangedWeights(
+         std::string("unchangedWeights"),
+         3 /*nxp*/,
+         3 /*nyp*/,
+         postLoc.nf,
+         &preLoc,
+         &postLoc,
+         1 /*numArbors*/,
+         true /*sharedWeights*/,
+         0.0 /*timestamp*/);
+   unchangedWeights.allocateDataStructures();
+   int const numWeights =
+         unchangedWeights.getNumDataPatches() * unchangedWeights.getPatchSizeOverall();
+   float *weightData = unchangedWeights.getData(0);
+   for (int k = 0; k < numWeights; k++) {
+      weightData[k] = (float)k;
+   }
+   checkpointer->registerCheckpointEntry(
+         std::make_shared<PV::CheckpointEntryWeightPvp>(
+               std::string("unchanged"),
+               std::string("W"),
+               mpiBlock,
+               &unchangedWeights,
+               false /*compressFlag*/),
+         false /*constantEntireRun*/);
+
+   int status = PV_SUCCESS;
+   for (int t = 0; t < 10; t++) {
+      for (std::size_t k = 0; k < changingData.size(); k++) {
+         changingData[k] = (float)(t + (int)k);
+      }
+      checkpointer->checkpointWrite((double)t);
+      if (mpiBlock->getRank() == 0) {
+         std::string checkpointDirectory(checkpointWriteDirectory);
+         checkpointDirectory.append("/Checkpoint0").append(std::to_string(t)).append("/");
+
+         // Each checkpoint that has not been deleted holds a link to the same file.
+         nlink_t const sharedCount = (nlink_t)std::min(t + 1, numKept);
+         std::string path;
+         path = checkpointDirectory + "constant_data.bin";
+         if (checkLinkCount(path, sharedCount) != PV_SUCCESS) {
+            status = PV_FAILURE;
+         }
+         if (checkContents(path, constantData) != PV_SUCCESS) {
+            status = PV_FAILURE;
+         }
+         path = checkpointDirectory + "unchanged_data.bin";
+         if (checkLinkCount(path, sharedCount) != PV_SUCCESS) {
+            status = PV_FAILURE;
+         }
+         if (checkContents(path, unchangedData) != PV_SUCCESS) {
+            status = PV_FAILURE;
+         }
+         // The weight file's header holds the time of the checkpoint that writes it, but the
+         // file is linked since the weights themselves do not change.
+         path = checkpointDirectory + "unchanged_W.pvp";
+         if (checkLinkCount(path, sharedCount) != PV_SUCCESS) {
+            status = PV_FAILURE;
+         }
+         path = checkpointDirectory + "changing_data.bin";
+         if (checkLinkCount(path, (nlink_t)1) != PV_SUCCESS) {
+            status = PV_FAILURE;
+         }
+         if (checkContents(path, changingData) != PV_SUCCESS) {
+            status = PV_FAILURE;
+         }
+      }
+   }
+   MPI_Bcast(&status, 1 /*count*/, MPI_INT, 0, mpiBlock->getComm());
+
+   delete checkpointer;
+   delete comm;
+   MPI_Finalize();
+
+   return status == PV_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
+}
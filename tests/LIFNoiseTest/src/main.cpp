@@ -0,0 +1,186 @@
+/*
+ * main.cpp
+ *
+ * Runs LIF and LIFGap layers with noise, one layer for each integration method, once with a
+ * single thread and once with several. After each run, the membrane potentials, conductances
+ * and random number generator states in the last checkpoint are compared with the files in
+ * input/baseline. With the --generate option, the single-threaded run's files are copied into
+ * input/baseline instead.
+ */
+
+#include <columns/buildandrun.hpp>
+#include <utils/BufferUtilsPvp.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+char const *layerNames[] = {"LIFOriginal",
+                            "LIFBeginning",
+                            "LIFArma",
+                            "LIFGapOriginal",
+                            "LIFGapBeginning",
+                            "LIFGapArma"};
+
+// The checkpoint entries holding float data. The random number generator states are in the
+// "rand_state" entry, which is compared byte for byte.
+char const *floatEntries[] = {"V", "Vth", "G_E", "G_I", "G_IB"};
+
+// The generator states do not depend on the thread count or on round-off, so they must match
+// exactly. The floating-point values are allowed a small relative tolerance, so that the
+// baseline survives a different compiler or math library.
+float const tolerance = 1.0e-5f;
+
+std::string const checkpointDir = "output/Last/";
+std::string const baselineDir   = "input/baseline/";
+
+std::vector<char> readFile(std::string const &path) {
+   std::ifstream stream(path, std::ios_base::in | std::ios_base::binary);
+   FatalIf(!stream, "Unable to open \"%s\" for reading.\n", path.c_str());
+   return std::vector<char>(
+         std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+}
+
+void copyFile(std::string const &sourcePath, std::string const &destPath) {
+   std::vector<char> contents = readFile(sourcePath);
+   std::ofstream stream(destPath, std::ios_base::out | std::ios_base::binary);
+   FatalIf(!stream, "Unable to open \"%s\" for writing.\n", destPath.c_str());
+   stream.write(contents.data(), (std::streamsize)contents.size());
+   FatalIf(!stream, "Unable to write \"%s\".\n", destPath.c_str());
+}
+
+int compareFloatEntry(std::string const &baselinePath, std::string const &outputPath, int nbatch) {
+   int status = PV_SUCCESS;
+   for (int b = 0; b < nbatch; b++) {
+      Buffer<float> baseline, output;
+      BufferUtils::readDenseFromPvp<float>(baselinePath.c_str(), &baseline, b);
+      BufferUtils::readDenseFromPvp<float>(outputPath.c_str(), &output, b);
+      FatalIf(
+            output.getTotalElements() != baseline.getTotalElements(),
+            "\"%s\" has %d values, but \"%s\" has %d.\n",
+            outputPath.c_str(),
+            output.getTotalElements(),
+            baselinePath.c_str(),
+            baseline.getTotalElements());
+      int numDiffs = 0;
+      for (int k = 0; k < baseline.getTotalElements(); k++) {
+         float const expected = baseline.at(k);
+         float const observed = output.at(k);
+         if (std::fabs(observed - expected) > tolerance * std::fmax(1.0f, std::fabs(expected))) {
+            if (numDiffs == 0) {
+               ErrorLog().printf(
+                     "\"%s\", batch element %d, neuron %d: expected %.9g, observed %.9g.\n",
+                     outputPath.c_str(),
+                     b,
+                     k,
+                     (double)expected,
+                     (double)observed);
+            }
+            numDiffs++;
+         }
+      }
+      if (numDiffs > 0) {
+         ErrorLog().printf(
+               "\"%s\", batch element %d: %d of %d values differ from the baseline.\n",
+               outputPath.c_str(),
+               b,
+               numDiffs,
+               baseline.getTotalElements());
+         status = PV_FAILURE;
+      }
+   }
+   return status;
+}
+
+int compareRandState(std::string const &baselinePath, std::string const &outputPath) {
+   if (readFile(outputPath) != readFile(baselinePath)) {
+      ErrorLog().printf(
+            "The random number generator states in \"%s\" differ from the baseline.\n",
+            outputPath.c_str());
+      return PV_FAILURE;
+   }
+   return PV_SUCCESS;
+}
+
+int runColumn(PV_Init *initObj, int numThreads, bool generateFlag) {
+   Configuration::IntOptional threadsArg;
+   threadsArg.mUseDefault = false;
+   threadsArg.mValue      = numThreads;
+   initObj->setIntOptionalArgument("NumThreads", threadsArg);
+   HyPerCol *hc = build(initObj);
+   FatalIf(hc->run() != PV_SUCCESS, "Run with %d threads failed.\n", numThreads);
+   int const nbatch = hc->getNBatchGlobal();
+   delete hc;
+
+   if (initObj->getWorldRank() != 0) {
+      return PV_SUCCESS;
+   }
+   int status = PV_SUCCESS;
+   for (char const *layerName : layerNames) {
+      std::string const prefix = std::string(layerName) + "_";
+      for (char const *entry : floatEntries) {
+         std::string const filename = prefix + entry + ".pvp";
+         if (generateFlag) {
+            copyFile(checkpointDir + filename, baselineDir + filename);
+         }
+         else if (
+               compareFloatEntry(baselineDir + filename, checkpointDir + filename, nbatch)
+               != PV_SUCCESS) {
+            status = PV_FAILURE;
+         }
+      }
+      std::string const filename = prefix + "rand_state.pvp";
+      if (generateFlag) {
+         copyFile(checkpointDir + filename, baselineDir + filename);
+      }
+      else if (compareRandState(baselineDir + filename, checkpointDir + filename) != PV_SUCCESS) {
+         status = PV_FAILURE;
+      }
+   }
+   if (status != PV_SUCCESS) {
+      ErrorLog().printf("The run with %d threads does not match the baseline.\n", numThreads);
+   }
+   return status;
+}
+
+int main(int argc, char *argv[]) {
+   PV_Init initObj(&argc, &argv, true /*allowUnrecognizedArguments*/);
+   // argv has to allow --generate.
+   bool generateFlag = false;
+   for (int arg = 1; arg < argc; arg++) {
+      if (!std::strcmp(argv[arg], "--generate")) {
+         generateFlag = true;
+      }
+   }
+   if (initObj.getParams() == nullptr) {
+      initObj.setParams("input/LIFNoiseTest.params");
+   }
+
+   // The threaded run uses the number of threads given on the command line, but at least two,
+   // so that the noise pass and the update kernels divide the rows among several threads.
+   Configuration::IntOptional threadedArg = initObj.getIntOptionalArgument("NumThreads");
+   int numThreads = threadedArg.mUseDefault ? 1 : threadedArg.mValue;
+#ifdef PV_USE_OPENMP_THREADS
+   if (numThreads < 2) {
+      numThreads = 2;
+   }
+#endif // PV_USE_OPENMP_THREADS
+
+   int status = runColumn(&initObj, 1, generateFlag);
+   if (generateFlag) {
+      if (initObj.getWorldRank() == 0) {
+         InfoLog() << "Wrote the baseline to \"" << baselineDir << "\".\n";
+      }
+      return status == PV_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
+   }
+   if (numThreads > 1 and runColumn(&initObj, numThreads, false) != PV_SUCCESS) {
+      status = PV_FAILURE;
+   }
+   if (status == PV_SUCCESS and initObj.getWorldRank() == 0) {
+      InfoLog() << "Test passed.\n";
+   }
+   return status == PV_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,51 @@
+/*
+ * main.cpp
+ *
+ * Runs a shared-weight plastic connection with fewer kernels than four times the number of
+ * threads, once with a single thread and once with several, and checks that the weights,
+ * which are the dW of the last update, agree.
+ */
+
+#include "ColumnArchive.hpp"
+#include <columns/buildandrun.hpp>
+
+int main(int argc, char *argv[]) {
+   PV_Init initObj(&argc, &argv, false /*allowUnrecognizedArguments*/);
+   if (initObj.getParams() == nullptr) {
+      initObj.setParams("input/ThreadedDeltaWeightsTest.params");
+   }
+
+   // The threaded run uses the number of threads given on the command line, but at least two,
+   // so that HebbianUpdater uses its per-thread copies of dW.
+   Configuration::IntOptional threadedArg = initObj.getIntOptionalArgument("NumThreads");
+#ifdef PV_USE_OPENMP_THREADS
+   if (threadedArg.mUseDefault or threadedArg.mValue < 2) {
+      threadedArg.mUseDefault = false;
+      threadedArg.mValue      = 2;
+   }
+#endif // PV_USE_OPENMP_THREADS
+
+   Configuration::IntOptional singleThreadArg;
+   singleThreadArg.mUseDefault = false;
+   singleThreadArg.mValue      = 1;
+   initObj.setIntOptionalArgument("NumThreads", singleThreadArg);
+   HyPerCol *hc = build(&initObj);
+   FatalIf(hc->run() != PV_SUCCESS, "Single-threaded run failed.\n");
+   // The copies are summed in a different order than the kernel-parallel update adds up the
+   // contributions, so the weights may differ by round-off.
+   ColumnArchive singleThreadArchive(hc, 0.0f /*layerTolerance*/, 1.0e-6f /*connTolerance*/);
+   delete hc;
+
+   initObj.setIntOptionalArgument("NumThreads", threadedArg);
+   hc = build(&initObj);
+   FatalIf(hc->run() != PV_SUCCESS, "Run with %d threads failed.\n", threadedArg.mValue);
+   ColumnArchive threadedArchive(hc, 0.0f /*layerTolerance*/, 1.0e-6f /*connTolerance*/);
+   delete hc;
+
+   FatalIf(
+         threadedArchive != singleThreadArchive,
+         "The weights with %d threads differ from those with one thread.\n",
+         threadedArg.mValue);
+   InfoLog() << "Test passed.\n";
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+/**
+ * accumulatekernelbenchmark, a C++ program to measure the speed of the inner loops of the
+ * convolve delivery methods, for each accumulate-kernel variant supported by the CPU.
+ * Usage: accumulatekernelbenchmark [maxWidth]
+ * For each patch width (number of floats per patch row) from 1 to maxWidth (default 64),
+ * prints the GFLOP/s achieved by the axpy (presynaptic) and dot (postsynaptic) kernels.
+ */
+
+#include <delivery/accumulate_kernels.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using PV::AccumulateKernels;
+using PV::AccumulateKernelVariant;
+
+// Rows are spaced so that consecutive rows do not share cache lines, and the whole working set
+// fits in the L2 cache, as a patch's weights typically do during delivery.
+int const rowStride = 80;
+int const numRows   = 256;
+
+double measureAxpy(AccumulateKernels const *kernels, int width) {
+   std::vector<float> weights(numRows * rowStride, 0.5f);
+   std::vector<float> gSyn(numRows * rowStride, 0.0f);
+   long const numRepetitions = 40000000L / (numRows * (width + 16));
+   auto start                = std::chrono::steady_clock::now();
+   for (long r = 0; r < numRepetitions; r++) {
+      for (int row = 0; row < numRows; row++) {
+         kernels->axpy(width, 1.0e-3f, &weights[row * rowStride], &gSyn[row * rowStride]);
+      }
+   }
+   std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+   double flops                          = 2.0 * width * numRows * (double)numRepetitions;
+   return flops / elapsed.count() * 1.0e-9;
+}
+
+double measureDot(AccumulateKernels const *kernels, int width) {
+   std::vector<float> weights(numRows * rowStride, 0.5f);
+   std::vector<float> activity(numRows * rowStride, 0.25f);
+   long const numRepetitions = 40000000L / (numRows * (width + 16));
+   float sum                 = 0.0f;
+   auto start                = std::chrono::steady_clock::now();
+   for (long r = 0; r < numRepetitions; r++) {
+      for (int row = 0; row < numRows; row++) {
+         sum += kernels->dot(width, &activity[row * rowStride], &weights[row * rowStride]);
+      }
+   }
+   std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+   // Keep the compiler from discarding the loop.
+   volatile float sink = sum;
+   (void)sink;
+   double flops = 2.0 * width * numRows * (double)numRepetitions;
+   return flops / elapsed.count() * 1.0e-9;
+}
+
+int main(int argc, char *argv[]) {
+   int maxWidth = 64;
+   if (argc > 1) {
+      maxWidth = std::atoi(argv[1]);
+   }
+   if (argc > 2 or maxWidth < 1 or maxWidth > rowStride) {
+      std::fprintf(stderr, "Usage: %s [maxWidth]\n", argv[0]);
+      std::fprintf(stderr, "  maxWidth must be between 1 and %d (default 64)\n", rowStride);
+      return EXIT_FAILURE;
+   }
+
+   std::vector<AccumulateKernels const *> variants;
+   for (int v = 0; v < PV::ACCUMULATE_KERNEL_NUM_VARIANTS; v++) {
+      AccumulateKernels const *kernels = PV::getAccumulateKernels((AccumulateKernelVariant)v);
+      if (kernels) {
+         variants.push_back(kernels);
+      }
+   }
+   std::printf("Selected variant: %s\n", PV::getAccumulateKernels().name);
+   std::printf("GFLOP/s for axpy (v[k] += a * w[k]) and dot (sum of a[k] * w[k])\n");
+
+   std::printf("%5s", "width");
+   for (auto *kernels : variants) {
+      std::printf("  %8s-axpy  %8s-dot", kernels->name, kernels->name);
+   }
+   std::printf("\n");
+   for (int width = 1; width <= maxWidth; width++) {
+      std::printf("%5d", width);
+      for (auto *kernels : variants) {
+         std::printf("  %13.2f  %12.2f", measureAxpy(kernels, width), measureDot(kernels, width));
+      }
+      std::printf("\n");
+   }
+   return EXIT_SUCCESS;
+}